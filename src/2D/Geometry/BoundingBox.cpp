@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "BoundingBox.h"
 
 BoundingBox::BoundingBox(const Point2D &lBound, const Point2D &uBound)
@@ -26,3 +28,19 @@ bool BoundingBox::isInBox(const Point2D &point) const
 {
     return point.x < uBound_.x && point.y < uBound_.y && point.x > lBound_.x && point.y > lBound_.y;
 }
+
+Scalar BoundingBox::distance(const Point2D &point) const
+{
+    Scalar dx = std::max(std::max(lBound_.x - point.x, point.x - uBound_.x), 0.);
+    Scalar dy = std::max(std::max(lBound_.y - point.y, point.y - uBound_.y), 0.);
+
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+Scalar BoundingBox::distance(const BoundingBox &box) const
+{
+    Scalar dx = std::max(std::max(lBound_.x - box.uBound_.x, box.lBound_.x - uBound_.x), 0.);
+    Scalar dy = std::max(std::max(lBound_.y - box.uBound_.y, box.lBound_.y - uBound_.y), 0.);
+
+    return std::sqrt(dx * dx + dy * dy);
+}
@@ -42,6 +42,11 @@ public:
 
     bool isInBox(const Point2D& point) const;
 
+    //- Distance to the box, zero if inside or overlapping
+    Scalar distance(const Point2D& point) const;
+
+    Scalar distance(const BoundingBox& box) const;
+
     const Point2D& lBound() const { return lBound_; }
 
     const Point2D& uBound() const { return uBound_; }
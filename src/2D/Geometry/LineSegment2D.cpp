@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "LineSegment2D.h"
 
 bool LineSegment2D::isBounded(const Point2D &pt) const
@@ -5,3 +7,14 @@ bool LineSegment2D::isBounded(const Point2D &pt) const
     Scalar t = dot(pt - ptA_, ptB_ - ptA_);
     return t >= 0. && t <= lengthSqr();
 }
+
+Point2D LineSegment2D::nearestPoint(const Point2D &pt) const
+{
+    Scalar lSqr = lengthSqr();
+
+    if (lSqr == 0.)
+        return ptA_;
+
+    Scalar t = std::max(0., std::min(1., dot(pt - ptA_, ptB_ - ptA_) / lSqr));
+    return ptA_ + t * (ptB_ - ptA_);
+}
@@ -41,6 +41,8 @@ public:
 
     bool isBounded(const Point2D &pt) const;
 
+    Point2D nearestPoint(const Point2D &pt) const;
+
 private:
 
     Point2D ptA_, ptB_;
@@ -0,0 +1,263 @@
+#include <algorithm>
+
+#include "Circle.h"
+#include "Box.h"
+#include "Polygon.h"
+#include "ShapeCollection.h"
+
+const Label ShapeCollection::blockSize;
+
+void ShapeCollection::clear()
+{
+    types_.clear();
+    params_.clear();
+    shapes_.clear();
+    values_.clear();
+    rTree_.clear();
+}
+
+void ShapeCollection::add(const Shape2D &shape)
+{
+    std::array<Scalar, 4> params = {0., 0., 0., 0.};
+
+    switch (shape.type())
+    {
+    case Shape2D::CIRCLE:
+    {
+        const Circle &circle = static_cast<const Circle&>(shape);
+        params = {circle.centroid().x, circle.centroid().y, circle.radius(), circle.radius() * circle.radius()};
+        break;
+    }
+    case Shape2D::BOX:
+    {
+        const Box &box = static_cast<const Box&>(shape);
+        params = {box.lower().x, box.lower().y, box.upper().x, box.upper().y};
+        break;
+    }
+    default:
+        break;
+    }
+
+    values_.push_back(std::make_pair(shape.boundingBox(), (Label) shapes_.size()));
+    types_.push_back(shape.type());
+    params_.push_back(params);
+    shapes_.push_back(&shape);
+}
+
+void ShapeCollection::init()
+{
+    //- Packing constructor, bulk loads the tree
+    rTree_ = boost::geometry::index::rtree<Value, Parameters>(values_.begin(), values_.end());
+}
+
+Index ShapeCollection::isInside(const Point2D &pt) const
+{
+    namespace bgi = boost::geometry::index;
+
+    Index result = -1;
+
+    for (auto qit = rTree_.qbegin(bgi::intersects(pt)); qit != rTree_.qend(); ++qit)
+        if ((result < 0 || (Index) qit->second < result) && contains(qit->second, pt))
+            result = qit->second;
+
+    return result;
+}
+
+void ShapeCollection::isInside(const std::vector<Point2D> &pts, std::vector<Index> &result) const
+{
+    namespace bg = boost::geometry;
+    namespace bgi = boost::geometry::index;
+
+    result.assign(pts.size(), -1);
+
+    std::vector<Label> candidates;
+    Scalar xs[blockSize], ys[blockSize];
+    Index ids[blockSize];
+
+    //- Points are processed in blocks, all candidate shapes of a block are tested against the whole block
+    for (Label begin = 0; begin < pts.size(); begin += blockSize)
+    {
+        Label n = std::min(blockSize, (Label) pts.size() - begin);
+        bg::model::box<Point2D> box(pts[begin], pts[begin]);
+
+        for (Label i = 0; i < n; ++i)
+        {
+            xs[i] = pts[begin + i].x;
+            ys[i] = pts[begin + i].y;
+            ids[i] = -1;
+            bg::expand(box, pts[begin + i]);
+        }
+
+        candidates.clear();
+
+        for (auto qit = rTree_.qbegin(bgi::intersects(box)); qit != rTree_.qend(); ++qit)
+            candidates.push_back(qit->second);
+
+        //- Lowest index wins when shapes overlap
+        std::sort(candidates.begin(), candidates.end());
+
+        for (Index j: candidates)
+        {
+            const std::array<Scalar, 4> &p = params_[j];
+
+            switch (types_[j])
+            {
+            case Shape2D::CIRCLE:
+                for (Label i = 0; i < n; ++i)
+                {
+                    Scalar dx = xs[i] - p[0];
+                    Scalar dy = ys[i] - p[1];
+                    ids[i] = ids[i] < 0 && dx * dx + dy * dy < p[3] ? j : ids[i];
+                }
+                break;
+            case Shape2D::BOX:
+                for (Label i = 0; i < n; ++i)
+                    ids[i] = ids[i] < 0 && xs[i] > p[0] && ys[i] > p[1] && xs[i] < p[2] && ys[i] < p[3] ? j : ids[i];
+                break;
+            default:
+                for (Label i = 0; i < n; ++i)
+                    if (ids[i] < 0 && contains(j, Point2D(xs[i], ys[i])))
+                        ids[i] = j;
+            }
+        }
+
+        std::copy(ids, ids + n, result.begin() + begin);
+    }
+}
+
+void ShapeCollection::allInside(const Point2D &pt, std::vector<Label> &result) const
+{
+    namespace bgi = boost::geometry::index;
+
+    result.clear();
+
+    for (auto qit = rTree_.qbegin(bgi::intersects(pt)); qit != rTree_.qend(); ++qit)
+        if (contains(qit->second, pt))
+            result.push_back(qit->second);
+}
+
+std::pair<Index, Point2D> ShapeCollection::nearestIntersect(const Point2D &pt) const
+{
+    namespace bgi = boost::geometry::index;
+
+    std::pair<Index, Point2D> result(-1, Point2D());
+    Scalar minDistSqr = std::numeric_limits<Scalar>::infinity();
+
+    //- A process may hold no shapes, and a nearest query for zero values is invalid
+    if (rTree_.empty())
+        return result;
+
+    //- Candidates are visited by increasing bounding box distance, which bounds the surface distance from below
+    for (auto qit = rTree_.qbegin(bgi::nearest(pt, rTree_.size())); qit != rTree_.qend(); ++qit)
+    {
+        Scalar dx = std::max(std::max(qit->first.min_corner().x - pt.x, pt.x - qit->first.max_corner().x), 0.);
+        Scalar dy = std::max(std::max(qit->first.min_corner().y - pt.y, pt.y - qit->first.max_corner().y), 0.);
+
+        if (dx * dx + dy * dy > minDistSqr)
+            break;
+
+        Point2D xc = nearestIntersect(qit->second, pt);
+        Scalar distSqr = (xc - pt).magSqr();
+
+        if (distSqr < minDistSqr)
+        {
+            result = std::make_pair((Index) qit->second, xc);
+            minDistSqr = distSqr;
+        }
+    }
+
+    return result;
+}
+
+void ShapeCollection::nearestIntersect(const std::vector<Point2D> &pts, std::vector<std::pair<Index, Point2D>> &result) const
+{
+    if (rTree_.empty())
+    {
+        result.assign(pts.size(), std::make_pair((Index) -1, Point2D()));
+        return;
+    }
+
+    result.resize(pts.size());
+
+    for (Label i = 0; i < pts.size(); ++i)
+        result[i] = nearestIntersect(pts[i]);
+}
+
+Point2D ShapeCollection::nearestIntersect(Label i, const Point2D &pt) const
+{
+    const std::array<Scalar, 4> &p = params_[i];
+
+    switch (types_[i])
+    {
+    case Shape2D::CIRCLE:
+    {
+        Vector2D r = pt - Point2D(p[0], p[1]);
+        return Point2D(p[0], p[1]) + r * (p[2] / r.mag());
+    }
+    case Shape2D::BOX:
+    {
+        //- Points outside are clamped, points inside are projected onto the closest edge
+        if (!(pt.x > p[0] && pt.y > p[1] && pt.x < p[2] && pt.y < p[3]))
+            return Point2D(std::min(std::max(pt.x, p[0]), p[2]), std::min(std::max(pt.y, p[1]), p[3]));
+
+        Scalar dxl = pt.x - p[0], dyl = pt.y - p[1], dxu = p[2] - pt.x, dyu = p[3] - pt.y;
+        Scalar minDist = std::min(std::min(dxl, dyl), std::min(dxu, dyu));
+
+        if (minDist == dxl)
+            return Point2D(p[0], pt.y);
+        else if (minDist == dyl)
+            return Point2D(pt.x, p[1]);
+        else if (minDist == dxu)
+            return Point2D(p[2], pt.y);
+
+        return Point2D(pt.x, p[3]);
+    }
+    default:
+        return shapes_[i]->nearestIntersect(pt);
+    }
+}
+
+void ShapeCollection::surfacesWithin(const Point2D &pt, Scalar radius, std::vector<Label> &result) const
+{
+    namespace bg = boost::geometry;
+    namespace bgi = boost::geometry::index;
+
+    result.clear();
+
+    bg::model::box<Point2D> box(Point2D(pt.x - radius, pt.y - radius), Point2D(pt.x + radius, pt.y + radius));
+
+    for (auto qit = rTree_.qbegin(bgi::intersects(box)); qit != rTree_.qend(); ++qit)
+    {
+        Label i = qit->second;
+        const std::array<Scalar, 4> &p = params_[i];
+
+        if (types_[i] == Shape2D::CIRCLE)
+        {
+            Scalar dist = std::abs((pt - Point2D(p[0], p[1])).mag() - p[2]);
+
+            if (dist <= radius)
+                result.push_back(i);
+        }
+        else if ((nearestIntersect(i, pt) - pt).magSqr() <= radius * radius)
+            result.push_back(i);
+    }
+}
+
+//- Private
+
+bool ShapeCollection::contains(Label i, const Point2D &pt) const
+{
+    const std::array<Scalar, 4> &p = params_[i];
+
+    switch (types_[i])
+    {
+    case Shape2D::CIRCLE:
+        return (pt - Point2D(p[0], p[1])).magSqr() < p[3];
+    case Shape2D::BOX:
+        return pt.x > p[0] && pt.y > p[1] && pt.x < p[2] && pt.y < p[3];
+    case Shape2D::POLYGON:
+        return boost::geometry::within(pt, static_cast<const Polygon*>(shapes_[i])->boostRing());
+    default:
+        return shapes_[i]->isInside(pt);
+    }
+}
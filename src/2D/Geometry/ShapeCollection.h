@@ -0,0 +1,67 @@
+#ifndef PHASE_SHAPE_COLLECTION_H
+#define PHASE_SHAPE_COLLECTION_H
+
+#include <array>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include "Shape2D.h"
+
+class ShapeCollection
+{
+public:
+
+    typedef boost::geometry::index::quadratic<8, 4> Parameters;
+
+    typedef std::pair<boost::geometry::model::box<Point2D>, Label> Value;
+
+    //- Number of points tested together against each candidate shape
+    static const Label blockSize = 64;
+
+    //- Initialization, shapes are referred to by the order in which they are added
+    void clear();
+
+    void add(const Shape2D &shape);
+
+    void init();
+
+    //- Access
+    Size size() const
+    { return shapes_.size(); }
+
+    const Shape2D &shape(Label i) const
+    { return *shapes_[i]; }
+
+    //- Point queries, the lowest index of a shape containing the point, -1 if none
+    Index isInside(const Point2D &pt) const;
+
+    void isInside(const std::vector<Point2D> &pts, std::vector<Index> &result) const;
+
+    void allInside(const Point2D &pt, std::vector<Label> &result) const;
+
+    //- Surface queries
+    std::pair<Index, Point2D> nearestIntersect(const Point2D &pt) const;
+
+    void nearestIntersect(const std::vector<Point2D> &pts, std::vector<std::pair<Index, Point2D>> &result) const;
+
+    Point2D nearestIntersect(Label i, const Point2D &pt) const;
+
+    void surfacesWithin(const Point2D &pt, Scalar radius, std::vector<Label> &result) const;
+
+private:
+
+    bool contains(Label i, const Point2D &pt) const;
+
+    //- Circles store (x, y, r, r^2), boxes store (xl, yl, xu, yu), other shapes use their own tests
+    std::vector<Shape2D::Type> types_;
+
+    std::vector<std::array<Scalar, 4>> params_;
+
+    std::vector<const Shape2D*> shapes_;
+
+    std::vector<Value> values_;
+
+    boost::geometry::index::rtree<Value, Parameters> rTree_;
+};
+
+#endif
@@ -2,58 +2,65 @@
 
 #include "Cicsam.h"
 #include "AxisymmetricCicsam.h"
+#include "AxisymmetricCourant.h"
 
-std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u, const ScalarFiniteVolumeField &gamma, const VectorFiniteVolumeField &gradGamma, Scalar timeStep)
+std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                                          const ScalarFiniteVolumeField &gamma,
+                                                          const VectorFiniteVolumeField &gradGamma,
+                                                          const ScalarFiniteVolumeField &co)
 {
     const Scalar k = 1;
+    const FaceGroup &faces = gamma.grid()->interiorFaces();
 
-    std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
+    std::vector<Scalar> gammaDTilde(faces.size()), coD(faces.size()), psiF(faces.size()), betaF;
 
-    for (const Face &face: gamma.grid()->interiorFaces())
+    for (Label i = 0; i < faces.size(); ++i)
     {
+        const Face &face = faces[i];
         Vector2D sf = face.polarOutwardNorm(face.lCell().centroid());
         Scalar flux = dot(u(face), sf);
 
         const Cell &d = flux > 0. ? face.lCell() : face.rCell();
         const Cell &a = flux <= 0. ? face.lCell() : face.rCell();
-        //const Cell &upwind = gamma.grid()->globalCells().nearestItem(2. * donor.centroid() - acceptor.centroid());
 
         Vector2D rc = a.centroid() - d.centroid();
 
         Scalar gammaD = clamp(gamma(d), 0., 1.);
         Scalar gammaA = clamp(gamma(a), 0., 1.);
         Scalar gammaU = clamp(gammaA - 2. * dot(rc, gradGamma(d)), 0., 1.);
-        // Scalar gammaU = clamp(gamma(upwind), 0., 1.);
 
-        Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
+        gammaDTilde[i] = (gammaD - gammaU) / (gammaA - gammaU);
 
-        if(std::isnan(gammaDTilde))
-            gammaDTilde = 0.;
+        if(std::isnan(gammaDTilde[i]))
+            gammaDTilde[i] = 0.;
 
-        Scalar coD = 0.; //- Cell courant number
-        for (const InteriorLink &nb: d.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.polarOutwardNorm()) / d.polarVolume() * timeStep, 0.);
+        coD[i] = co(d);
 
-        for (const BoundaryLink &bd: d.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.polarOutwardNorm()) / d.polarVolume() * timeStep, 0.);
+        Scalar cosThetaF = dot(gradGamma(d).unitVec(), rc.unitVec());
+        psiF[i] = std::min(k * cosThetaF * cosThetaF, 1.);
+    }
 
-        Scalar thetaF = std::acos(std::abs(dot(gradGamma(d).unitVec(), rc.unitVec())));
-        Scalar psiF = std::min(k * (std::cos(2 * thetaF) + 1.) / 2., 1.);
-        Scalar gammaFTilde = psiF * ::cicsam::hc(gammaDTilde, coD) + (1. - psiF) * ::cicsam::uq(gammaDTilde, coD);
-        Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
+    ::cicsam::blend(gammaDTilde, coD, psiF, betaF);
 
-        if(std::isfinite(betaFace))
-            betaFace = std::max(std::min(1., betaFace), 0.);
-        else
-            betaFace = 0.;
+    std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
 
-        //- If stencil cannot be computed, default to upwind
-        beta[face.id()] = betaFace;
-    }
+    for (Label i = 0; i < faces.size(); ++i)
+        beta[faces[i].id()] = betaF[i];
 
     return beta;
 }
 
+std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                                          const ScalarFiniteVolumeField &gamma,
+                                                          const VectorFiniteVolumeField &gradGamma,
+                                                          Scalar timeStep)
+{
+    ScalarFiniteVolumeField co(gamma.grid(), "co", 0., false);
+    axi::courantNumber(u, timeStep, co);
+
+    return faceInterpolationWeights(u, gamma, gradGamma, co);
+}
+
 FiniteVolumeEquation<Scalar> axi::cicsam::div(const VectorFiniteVolumeField &u, ScalarFiniteVolumeField &gamma, const std::vector<Scalar> &faceInterpolationWeights, Scalar theta, const CellGroup &cells)
 {
     FiniteVolumeEquation<Scalar> eqn(gamma, 5);
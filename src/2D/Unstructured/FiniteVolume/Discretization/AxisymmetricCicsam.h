@@ -8,6 +8,11 @@ namespace axi
 namespace cicsam
 {
 
+std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                             const ScalarFiniteVolumeField &gamma,
+                                             const VectorFiniteVolumeField &gradGamma,
+                                             const ScalarFiniteVolumeField &co);
+
 std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                              const ScalarFiniteVolumeField &gamma,
                                              const VectorFiniteVolumeField &gradGamma,
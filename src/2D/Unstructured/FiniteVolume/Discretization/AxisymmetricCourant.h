@@ -0,0 +1,12 @@
+#ifndef PHASE_AXISYMMETRIC_COURANT_H
+#define PHASE_AXISYMMETRIC_COURANT_H
+
+#include "FiniteVolume/Field/VectorFiniteVolumeField.h"
+
+namespace axi
+{
+    //- Cell Courant numbers based on the polar face areas and cell volumes
+    void courantNumber(const VectorFiniteVolumeField &u, Scalar timeStep, ScalarFiniteVolumeField &co);
+}
+
+#endif
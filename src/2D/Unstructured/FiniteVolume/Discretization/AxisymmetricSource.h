@@ -4,6 +4,7 @@
 #include "Math/Vector.h"
 
 #include "FiniteVolume/Field/VectorFiniteVolumeField.h"
+#include "FiniteVolume/Discretization/Source.h"
 
 namespace axi
 {
@@ -13,6 +14,22 @@ namespace axi
 
         Vector src(const VectorFiniteVolumeField &u);
 
+        template<class E>
+        Vector src(const FieldExpression<E> &expr)
+        {
+            typedef typename E::ValueType T;
+            const E &e = expr.self();
+            const IndexMap &indexMap = *e.indexMap();
+            const int nComponents = std::is_same<T, Vector2D>::value ? 2 : 1;
+
+            Vector vec(nComponents * e.grid()->localCells().size());
+
+            for (const Cell &cell: e.cells())
+                ::src::setSrc(vec, indexMap, cell, e.cell(cell.id()) * cell.polarVolume());
+
+            return vec;
+        }
+
         Vector div(const VectorFiniteVolumeField &u);
     }
 }
@@ -2,6 +2,8 @@
 
 #include "Math/Algorithm.h"
 
+#include "Courant.h"
+
 Scalar cicsam::hc(Scalar gammaDTilde, Scalar coD)
 {
     return gammaDTilde >= 0 && gammaDTilde <= 1 ? std::min(1., gammaDTilde / coD) : gammaDTilde;
@@ -14,17 +16,35 @@ Scalar cicsam::uq(Scalar gammaDTilde, Scalar coD)
                 gammaDTilde;
 }
 
+void cicsam::blend(const std::vector<Scalar> &gammaDTilde,
+                   const std::vector<Scalar> &coD,
+                   const std::vector<Scalar> &psiF,
+                   std::vector<Scalar> &betaF)
+{
+    betaF.resize(gammaDTilde.size());
+
+    for (Label i = 0; i < gammaDTilde.size(); ++i)
+    {
+        Scalar gammaFTilde = psiF[i] * hc(gammaDTilde[i], coD[i]) + (1. - psiF[i]) * uq(gammaDTilde[i], coD[i]);
+        Scalar betaFace = (gammaFTilde - gammaDTilde[i]) / (1. - gammaDTilde[i]);
+        betaF[i] = std::isfinite(betaFace) ? std::max(std::min(1., betaFace), 0.) : 0.;
+    }
+}
+
 std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                                      const ScalarFiniteVolumeField &gamma,
                                                      const VectorFiniteVolumeField &gradGamma,
-                                                     Scalar timeStep)
+                                                     const ScalarFiniteVolumeField &co)
 {
     const Scalar k = 1;
+    const FaceGroup &faces = gamma.grid()->interiorFaces();
 
-    std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
+    std::vector<Scalar> gammaDTilde(faces.size()), coD(faces.size()), psiF(faces.size()), betaF;
 
-    for (const Face &face: gamma.grid()->interiorFaces())
+    //- Gather the donor-acceptor stencils into contiguous arrays
+    for (Label i = 0; i < faces.size(); ++i)
     {
+        const Face &face = faces[i];
         Vector2D sf = face.outwardNorm(face.lCell().centroid());
         Scalar flux = dot(u(face), sf);
         const Cell &donor = flux > 0. ? face.lCell() : face.rCell();
@@ -35,34 +55,40 @@ std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeFie
         Scalar gammaD = clamp(gamma(donor), 0., 1.);
         Scalar gammaA = clamp(gamma(acceptor), 0., 1.);
         Scalar gammaU = clamp(gammaA - 2. * dot(rc, gradGamma(donor)), 0., 1.);
-        Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
 
-        if(!std::isfinite(gammaDTilde))
-            gammaDTilde = 0.;
+        gammaDTilde[i] = (gammaD - gammaU) / (gammaA - gammaU);
 
-        Scalar coD = 0.; //- Cell courant number
-        for (const InteriorLink &nb: donor.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.outwardNorm()) / donor.volume() * timeStep, 0.);
+        if(!std::isfinite(gammaDTilde[i]))
+            gammaDTilde[i] = 0.;
 
-        for (const BoundaryLink &bd: donor.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.outwardNorm()) / donor.volume() * timeStep, 0.);
+        coD[i] = co(donor);
 
-        Scalar thetaF = std::acos(std::abs(dot(gradGamma(donor).unitVec(), rc.unitVec())));
-        Scalar psiF = std::min(k * (std::cos(2 * thetaF) + 1.) / 2., 1.);
-        Scalar gammaFTilde = psiF * hc(gammaDTilde, coD) + (1. - psiF) * uq(gammaDTilde, coD);
-        Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
+        //- (cos(2 theta) + 1) / 2 = cos^2(theta)
+        Scalar cosThetaF = dot(gradGamma(donor).unitVec(), rc.unitVec());
+        psiF[i] = std::min(k * cosThetaF * cosThetaF, 1.);
+    }
 
-        if(std::isfinite(betaFace))
-            betaFace = std::max(std::min(1., betaFace), 0.);
-        else
-            betaFace = 0.;
+    blend(gammaDTilde, coD, psiF, betaF);
 
-        beta[face.id()] = betaFace;
-    }
+    std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
+
+    for (Label i = 0; i < faces.size(); ++i)
+        beta[faces[i].id()] = betaF[i];
 
     return beta;
 }
 
+std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                                     const ScalarFiniteVolumeField &gamma,
+                                                     const VectorFiniteVolumeField &gradGamma,
+                                                     Scalar timeStep)
+{
+    ScalarFiniteVolumeField co(gamma.grid(), "co", 0., false);
+    fv::courantNumber(u, timeStep, co);
+
+    return faceInterpolationWeights(u, gamma, gradGamma, co);
+}
+
 void cicsam::computeMomentumFlux(Scalar rho1,
                                  Scalar rho2,
                                  const VectorFiniteVolumeField &u,
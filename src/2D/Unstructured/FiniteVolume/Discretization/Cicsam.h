@@ -9,6 +9,17 @@ Scalar hc(Scalar gammaDTilde, Scalar coD);
 
 Scalar uq(Scalar gammaDTilde, Scalar coD);
 
+//- Face weights from the normalised donor values, donor Courant numbers and blending factors of a set of faces
+void blend(const std::vector<Scalar> &gammaDTilde,
+           const std::vector<Scalar> &coD,
+           const std::vector<Scalar> &psiF,
+           std::vector<Scalar> &betaF);
+
+std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                             const ScalarFiniteVolumeField &gamma,
+                                             const VectorFiniteVolumeField &gradGamma,
+                                             const ScalarFiniteVolumeField &co);
+
 std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                              const ScalarFiniteVolumeField &gamma,
                                              const VectorFiniteVolumeField &gradGamma,
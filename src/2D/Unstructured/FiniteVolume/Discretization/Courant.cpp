@@ -0,0 +1,19 @@
+#include "Courant.h"
+
+void fv::courantNumber(const VectorFiniteVolumeField &u, Scalar timeStep, ScalarFiniteVolumeField &co)
+{
+    for (const Cell &cell: co.grid()->localCells())
+    {
+        Scalar flux = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            flux += std::max(dot(u(nb.face()), nb.outwardNorm()), 0.);
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            flux += std::max(dot(u(bd.face()), bd.outwardNorm()), 0.);
+
+        co(cell) = flux * timeStep / cell.volume();
+    }
+
+    co.sendMessages();
+}
@@ -0,0 +1,12 @@
+#ifndef PHASE_COURANT_H
+#define PHASE_COURANT_H
+
+#include "FiniteVolume/Field/VectorFiniteVolumeField.h"
+
+namespace fv
+{
+    //- Cell Courant numbers from the outgoing face fluxes of every local cell, buffer cells are updated
+    void courantNumber(const VectorFiniteVolumeField &u, Scalar timeStep, ScalarFiniteVolumeField &co);
+}
+
+#endif
@@ -1,11 +1,12 @@
 #include "Hric.h"
 #include "Math/Algorithm.h"
 #include "Cicsam.h"
+#include "Courant.h"
 
 ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
                                    const VectorFiniteVolumeField &gradGamma,
                                    const ScalarFiniteVolumeField &gamma,
-                                   Scalar timeStep)
+                                   const ScalarFiniteVolumeField &co)
 {
     ScalarFiniteVolumeField beta(gamma.grid(), "beta");
 
@@ -22,12 +23,7 @@ ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
         Scalar gammaU = clamp(gammaA - 2.*dot(rc, gradGamma(donor)), 0., 1.);
         Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
 
-        Scalar coD = 0.; //- Cell courant number
-        for(const InteriorLink& nb: donor.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.outwardNorm()) / donor.volume() * timeStep, 0.);
-
-        for(const BoundaryLink& bd: donor.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.outwardNorm()) / donor.volume() * timeStep, 0.);
+        Scalar coD = co(donor); //- Cell courant number
 
         Scalar gammaFTilde = gammaDTilde < 0. || gammaDTilde > 1. ? gammaDTilde:
                              0. <= gammaDTilde && gammaDTilde < 0.5 ? 2. * gammaDTilde: 1.;
@@ -48,6 +44,17 @@ ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
     return beta;
 }
 
+ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
+                                   const VectorFiniteVolumeField &gradGamma,
+                                   const ScalarFiniteVolumeField &gamma,
+                                   Scalar timeStep)
+{
+    ScalarFiniteVolumeField co(gamma.grid(), "co", 0., false);
+    fv::courantNumber(u, timeStep, co);
+
+    return beta(u, gradGamma, gamma, co);
+}
+
 FiniteVolumeEquation<Scalar> hric::div(const VectorFiniteVolumeField &u,
                            const ScalarFiniteVolumeField& beta,
                            ScalarFiniteVolumeField &gamma,
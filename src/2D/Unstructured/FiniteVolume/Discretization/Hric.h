@@ -5,6 +5,11 @@
 
 namespace hric
 {
+    ScalarFiniteVolumeField beta(const VectorFiniteVolumeField &u,
+                                 const VectorFiniteVolumeField &gradGamma,
+                                 const ScalarFiniteVolumeField &gamma,
+                                 const ScalarFiniteVolumeField &co);
+
     ScalarFiniteVolumeField beta(const VectorFiniteVolumeField &u,
                                  const VectorFiniteVolumeField &gradGamma,
                                  const ScalarFiniteVolumeField &gamma,
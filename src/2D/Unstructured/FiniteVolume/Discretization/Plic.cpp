@@ -1,7 +1,256 @@
+#include <algorithm>
+
 #include "Plic.h"
 #include "FiniteVolume/Field/ScalarGradient.h"
 #include "Math/Algorithm.h"
 
 namespace plic {
 
+    //- Volume fractions closer than this to 0 or 1 are not reconstructed
+    const Scalar eps = 1e-10;
+
+    std::vector<Point2D> vertices(const Cell &cell)
+    {
+        const std::vector<Point2D> &ring = cell.shape().vertices();
+        return std::vector<Point2D>(ring.begin(), ring.end() - 1);
+    }
+
+}
+
+std::vector<Point2D> plic::clip(const std::vector<Point2D> &verts, const Vector2D &n, Scalar d)
+{
+    std::vector<Point2D> result;
+    result.reserve(verts.size() + 1);
+
+    for (Label i = 0; i < verts.size(); ++i)
+    {
+        const Point2D &a = verts[i];
+        const Point2D &b = verts[(i + 1) % verts.size()];
+
+        Scalar da = dot(n, a) - d;
+        Scalar db = dot(n, b) - d;
+
+        if (da <= 0.)
+            result.push_back(a);
+
+        if ((da < 0. && db > 0.) || (da > 0. && db < 0.))
+            result.push_back(a + da / (da - db) * (b - a));
+    }
+
+    return result;
+}
+
+Scalar plic::area(const std::vector<Point2D> &verts)
+{
+    Scalar area = 0.;
+
+    for (Label i = 0; i < verts.size(); ++i)
+        area += cross(verts[i], verts[(i + 1) % verts.size()]);
+
+    return area / 2.;
+}
+
+plic::Interface plic::reconstruct(const Cell &cell, Scalar gamma, const Vector2D &gradGamma)
+{
+    Interface interface{-gradGamma.unitVec(), 0., gamma > eps && gamma < 1. - eps};
+
+    if (!interface.isMixed || !std::isfinite(interface.n.x) || !std::isfinite(interface.n.y))
+    {
+        interface.isMixed = false;
+        return interface;
+    }
+
+    const Vector2D &n = interface.n;
+    std::vector<Point2D> verts = vertices(cell);
+
+    //- The clipped area is piecewise quadratic in d between the vertex levels, locate the bracketing levels first
+    std::vector<Scalar> levels;
+    levels.reserve(verts.size());
+
+    for (const Point2D &vtx: verts)
+        levels.push_back(dot(n, vtx));
+
+    std::sort(levels.begin(), levels.end());
+
+    Scalar target = gamma * cell.volume();
+    Scalar dl = levels.front(), fl = 0.;
+    Scalar du = levels.back(), fu = cell.volume();
+
+    for (Label i = 1; i < levels.size() - 1; ++i)
+    {
+        Scalar f = area(clip(verts, n, levels[i]));
+
+        if (f < target)
+        {
+            dl = levels[i];
+            fl = f;
+        }
+        else
+        {
+            du = levels[i];
+            fu = f;
+            break;
+        }
+    }
+
+    //- Exact within the bracket, the quadratic is fitted through the ends and the midpoint
+    Scalar fm = area(clip(verts, n, (dl + du) / 2.));
+    Scalar a = 2. * fu - 4. * fm + 2. * fl;
+    Scalar b = 4. * fm - fu - 3. * fl;
+    Scalar c = fl - target;
+    Scalar t;
+
+    if (std::abs(a) < eps * cell.volume())
+        t = -c / b;
+    else
+    {
+        Scalar sqrtDisc = std::sqrt(std::max(b * b - 4. * a * c, 0.));
+        t = (-b + sqrtDisc) / (2. * a);
+
+        if (t < 0. || t > 1.)
+            t = (-b - sqrtDisc) / (2. * a);
+    }
+
+    interface.d = dl + clamp(t, 0., 1.) * (du - dl);
+
+    return interface;
+}
+
+std::vector<Scalar> plic::faceFluxes(const VectorFiniteVolumeField &u,
+                                     const ScalarFiniteVolumeField &gamma,
+                                     const VectorFiniteVolumeField &gradGamma,
+                                     Scalar timeStep)
+{
+    const FiniteVolumeGrid2D &grid = *gamma.grid();
+
+    std::vector<Scalar> fluxes(grid.faces().size(), 0.);
+    std::vector<Interface> interfaces(grid.cells().size());
+    std::vector<bool> isReconstructed(grid.cells().size(), false);
+
+    //- Nodes are traced back with their own velocity, so faces sharing a node share the traced vertex and
+    //  the swept regions of a cell neither overlap nor leave gaps at its corners
+    std::vector<Point2D> tracedNodes(grid.nodes().size());
+
+    for (const Node &node: grid.nodes())
+    {
+        Vector2D un(0., 0.);
+        std::vector<Scalar> weights = node.volumeWeights();
+
+        for (Label i = 0; i < weights.size(); ++i)
+            un += weights[i] * u(node.cells()[i].get());
+
+        tracedNodes[node.id()] = node - un * timeStep;
+    }
+
+    Scalar maxFaceCo = 0.;
+
+    for (const Face &face: grid.interiorFaces())
+    {
+        Vector2D sf = face.outwardNorm(face.lCell().centroid());
+        Scalar flux = dot(u(face), sf) * timeStep;
+        const Cell &donor = flux > 0. ? face.lCell() : face.rCell();
+
+        maxFaceCo = std::max(std::abs(flux) / donor.volume(), maxFaceCo);
+
+        if (!isReconstructed[donor.id()])
+        {
+            interfaces[donor.id()] = reconstruct(donor, gamma(donor), gradGamma(donor));
+            isReconstructed[donor.id()] = true;
+        }
+
+        const Interface &interface = interfaces[donor.id()];
+
+        if (!interface.isMixed)
+        {
+            fluxes[face.id()] = flux * clamp(gamma(donor), 0., 1.);
+            continue;
+        }
+
+        //- The swept region spans the face and its traced nodes. Its area only approximates the volume flux,
+        //  so it sets the phase fraction of the flux rather than the fluxed volume
+        Vector2D ns = (flux > 0. ? sf : -sf).unitVec();
+        const Node &a = face.lNode();
+        const Node &b = face.rNode();
+        std::vector<Point2D> fluxPgn = {tracedNodes[a.id()], tracedNodes[b.id()], b, a};
+
+        Scalar pgnArea = area(fluxPgn);
+
+        //- A folded region (strongly sheared or reversing node velocities) falls back to the donor value
+        if (pgnArea * cross(b - a, ns) <= 0.)
+        {
+            fluxes[face.id()] = flux * clamp(gamma(donor), 0., 1.);
+            continue;
+        }
+
+        fluxes[face.id()] = flux * clamp(area(clip(fluxPgn, interface.n, interface.d)) / pgnArea, 0., 1.);
+    }
+
+    //- The swept region must stay within the donor cell, all processes throw together
+    maxFaceCo = grid.comm().max(maxFaceCo);
+
+    if (maxFaceCo > maxCo)
+        throw Exception("plic", "faceFluxes",
+                        "face Courant number " + std::to_string(maxFaceCo) + " exceeds "
+                        + std::to_string(maxCo) + ", reduce Solver.maxCo or enable Solver.subCycleGamma.");
+
+    for (const FaceGroup &patch: grid.patches())
+        for (const Face &face: patch)
+        {
+            Scalar flux = dot(u(face), face.outwardNorm(face.lCell().centroid())) * timeStep;
+
+            switch (gamma.boundaryType(face))
+            {
+            case ScalarFiniteVolumeField::FIXED:
+                fluxes[face.id()] = flux * gamma(face);
+                break;
+
+            case ScalarFiniteVolumeField::NORMAL_GRADIENT:
+                fluxes[face.id()] = flux * gamma(face.lCell());
+                break;
+
+            case ScalarFiniteVolumeField::SYMMETRY:
+                break;
+
+            default:
+                throw Exception("plic", "faceFluxes", "unrecognized or unspecified boundary type.");
+            }
+        }
+
+    return fluxes;
+}
+
+Scalar plic::advect(const VectorFiniteVolumeField &u,
+                    const VectorFiniteVolumeField &gradGamma,
+                    ScalarFiniteVolumeField &gamma,
+                    Scalar timeStep,
+                    const CellGroup &cells)
+{
+    const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
+    std::vector<Scalar> fluxes = faceFluxes(u, gamma0, gradGamma, timeStep);
+    Scalar clippedVolume = 0.;
+
+    for (const Cell &cell: cells)
+    {
+        Scalar netFlux = 0.;
+
+        for (const InteriorLink &nb: cell.neighbours())
+            netFlux += &nb.face().lCell() == &cell ? fluxes[nb.face().id()] : -fluxes[nb.face().id()];
+
+        for (const BoundaryLink &bd: cell.boundaries())
+            netFlux += fluxes[bd.face().id()];
+
+        Scalar newGamma = gamma0(cell) - netFlux / cell.volume();
+        gamma(cell) = clamp(newGamma, 0., 1.);
+        clippedVolume += std::abs(newGamma - gamma(cell)) * cell.volume();
+    }
+
+    return gamma.grid()->comm().sum(clippedVolume);
+}
+
+Scalar plic::advect(const VectorFiniteVolumeField &u,
+                    const VectorFiniteVolumeField &gradGamma,
+                    ScalarFiniteVolumeField &gamma,
+                    Scalar timeStep)
+{
+    return advect(u, gradGamma, gamma, timeStep, gamma.cells());
 }
@@ -5,18 +5,46 @@
 
 namespace plic {
 
-    FiniteVolumeEquation<Scalar> div(const VectorFiniteVolumeField& u,
-                         const VectorFiniteVolumeField& gradGamma,
-                         ScalarFiniteVolumeField& gamma,
-                         Scalar timeStep);
-
-/*
-FiniteVolumeEquation<ScalarFiniteVolumeField> div(const VectorFiniteVolumeField &u, const VectorFiniteVolumeField& gradGamma, ScalarFiniteVolumeField &field, Scalar timeStep,
-                                      std::vector<Polygon>& plicPolygons);
-
-Polygon computeInterfacePolygon(const Cell& cell, Scalar &gamma, const Vector2D& normal);
-Polygon computeFluxPolygon(const BoundaryLink &link, const Vector2D& uf, Scalar timeStep, int componentNo);
-*/
+    //- Piecewise linear interface of a mixed cell, the phase gamma = 1 occupies the points x with dot(n, x) <= d
+    struct Interface
+    {
+        Vector2D n;
+
+        Scalar d;
+
+        bool isMixed;
+    };
+
+    //- Polygon utilities, vertices are counter-clockwise and not closed
+    std::vector<Point2D> clip(const std::vector<Point2D> &verts, const Vector2D &n, Scalar d);
+
+    Scalar area(const std::vector<Point2D> &verts);
+
+    //- Finds the line constant such that the clipped cell holds the volume fraction gamma
+    Interface reconstruct(const Cell &cell, Scalar gamma, const Vector2D &gradGamma);
+
+    //- Largest face Courant number, with respect to the donor cell, for which the swept regions stay in the donor
+    const Scalar maxCo = 0.5;
+
+    //- Phase volumes crossing each face during a time step, signed with respect to the face's left cell. Throws
+    //  on all processes if a face Courant number exceeds maxCo
+    std::vector<Scalar> faceFluxes(const VectorFiniteVolumeField &u,
+                                   const ScalarFiniteVolumeField &gamma,
+                                   const VectorFiniteVolumeField &gradGamma,
+                                   Scalar timeStep);
+
+    //- Explicit geometric update of gamma from its previous time level, no linear system is solved. Returns the
+    //  total volume removed or added, over all processes, by bounding gamma to [0, 1]
+    Scalar advect(const VectorFiniteVolumeField &u,
+                  const VectorFiniteVolumeField &gradGamma,
+                  ScalarFiniteVolumeField &gamma,
+                  Scalar timeStep,
+                  const CellGroup &cells);
+
+    Scalar advect(const VectorFiniteVolumeField &u,
+                  const VectorFiniteVolumeField &gradGamma,
+                  ScalarFiniteVolumeField &gamma,
+                  Scalar timeStep);
 }
 
 #endif
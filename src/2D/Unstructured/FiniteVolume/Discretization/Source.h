@@ -21,6 +21,32 @@ namespace src
     Vector src(const ScalarFiniteVolumeField &field);
 
     Vector src(const VectorFiniteVolumeField &field);
+
+    inline void setSrc(Vector &vec, const IndexMap &indexMap, const Cell &cell, Scalar val)
+    { vec(indexMap.local(cell, 0)) = val; }
+
+    inline void setSrc(Vector &vec, const IndexMap &indexMap, const Cell &cell, const Vector2D &val)
+    {
+        vec(indexMap.local(cell, 0)) = val.x;
+        vec(indexMap.local(cell, 1)) = val.y;
+    }
+
+    //- Evaluates a field expression directly into the source vector
+    template<class E>
+    Vector src(const FieldExpression<E> &expr)
+    {
+        typedef typename E::ValueType T;
+        const E &e = expr.self();
+        const IndexMap &indexMap = *e.indexMap();
+        const int nComponents = std::is_same<T, Vector2D>::value ? 2 : 1;
+
+        Vector vec(nComponents * e.grid()->localCells().size());
+
+        for (const Cell &cell: e.cells())
+            setSrc(vec, indexMap, cell, e.cell(cell.id()) * cell.volume());
+
+        return vec;
+    }
 }
 
 #endif
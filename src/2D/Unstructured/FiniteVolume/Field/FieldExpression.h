@@ -0,0 +1,333 @@
+#ifndef PHASE_FIELD_EXPRESSION_H
+#define PHASE_FIELD_EXPRESSION_H
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "Geometry/Vector2D.h"
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
+#include "FiniteVolume/Equation/IndexMap.h"
+
+template<class T>
+class FiniteVolumeField;
+
+//- Lazy field arithmetic. The field operators only build a small expression tree, which is evaluated
+//  element by element when it is assigned to a field or consumed by src::src, so compound expressions
+//  are computed in a single loop without temporary fields
+template<class E>
+class FieldExpression
+{
+public:
+
+    const E &self() const
+    { return static_cast<const E &>(*this); }
+};
+
+namespace expr
+{
+    //- Leaves
+    template<class T, class Storage>
+    class FieldLeaf : public FieldExpression<FieldLeaf<T, Storage>>
+    {
+    public:
+
+        typedef T ValueType;
+
+        static const bool isConstant = false;
+
+        template<class F>
+        explicit FieldLeaf(F &&field)
+            :
+              field_(std::forward<F>(field))
+        {}
+
+        T cell(Label id) const
+        { return field_(id); }
+
+        T face(Label id) const
+        { return field_.faces()[id]; }
+
+        T node(Label id) const
+        { return field_.nodes()[id]; }
+
+        bool hasFaces() const
+        { return field_.hasFaces(); }
+
+        bool hasNodes() const
+        { return field_.hasNodes(); }
+
+        const std::string &name() const
+        { return field_.name(); }
+
+        const std::shared_ptr<const FiniteVolumeGrid2D> &grid() const
+        { return field_.grid(); }
+
+        const CellGroup &cells() const
+        { return field_.cells(); }
+
+        const std::shared_ptr<IndexMap> &indexMap() const
+        { return field_.indexMap(); }
+
+    private:
+
+        //- Named fields are referenced, temporaries are moved into the expression so they outlive it
+        Storage field_;
+    };
+
+    template<class T>
+    class Constant : public FieldExpression<Constant<T>>
+    {
+    public:
+
+        typedef T ValueType;
+
+        static const bool isConstant = true;
+
+        explicit Constant(const T &val)
+            :
+              val_(val)
+        {}
+
+        T cell(Label) const
+        { return val_; }
+
+        T face(Label) const
+        { return val_; }
+
+        T node(Label) const
+        { return val_; }
+
+        bool hasFaces() const
+        { return true; }
+
+        bool hasNodes() const
+        { return true; }
+
+    private:
+
+        T val_;
+    };
+
+    //- Operations
+    struct Add
+    {
+        template<class A, class B>
+        static auto apply(const A &a, const B &b) -> decltype(a + b)
+        { return a + b; }
+    };
+
+    struct Subtract
+    {
+        template<class A, class B>
+        static auto apply(const A &a, const B &b) -> decltype(a - b)
+        { return a - b; }
+    };
+
+    struct Multiply
+    {
+        template<class A, class B>
+        static auto apply(const A &a, const B &b) -> decltype(a * b)
+        { return a * b; }
+    };
+
+    struct Divide
+    {
+        template<class A, class B>
+        static auto apply(const A &a, const B &b) -> decltype(a / b)
+        { return a / b; }
+    };
+
+    //- Selects the operand that carries the grid, cell group and index map of a binary expression
+    template<bool lhsIsConstant>
+    struct Lead
+    {
+        template<class L, class R>
+        static const L &get(const L &lhs, const R &)
+        { return lhs; }
+    };
+
+    template<>
+    struct Lead<true>
+    {
+        template<class L, class R>
+        static const R &get(const L &, const R &rhs)
+        { return rhs; }
+    };
+
+    template<class L, class R, class Op>
+    class Binary : public FieldExpression<Binary<L, R, Op>>
+    {
+    public:
+
+        typedef decltype(Op::apply(std::declval<typename L::ValueType>(),
+                                   std::declval<typename R::ValueType>())) ValueType;
+
+        static const bool isConstant = false;
+
+        Binary(L lhs, R rhs)
+            :
+              lhs_(std::move(lhs)),
+              rhs_(std::move(rhs))
+        {}
+
+        ValueType cell(Label id) const
+        { return Op::apply(lhs_.cell(id), rhs_.cell(id)); }
+
+        ValueType face(Label id) const
+        { return Op::apply(lhs_.face(id), rhs_.face(id)); }
+
+        ValueType node(Label id) const
+        { return Op::apply(lhs_.node(id), rhs_.node(id)); }
+
+        bool hasFaces() const
+        { return lhs_.hasFaces() && rhs_.hasFaces(); }
+
+        bool hasNodes() const
+        { return lhs_.hasNodes() && rhs_.hasNodes(); }
+
+        const std::string &name() const
+        { return lead().name(); }
+
+        const std::shared_ptr<const FiniteVolumeGrid2D> &grid() const
+        { return lead().grid(); }
+
+        const CellGroup &cells() const
+        { return lead().cells(); }
+
+        const std::shared_ptr<IndexMap> &indexMap() const
+        { return lead().indexMap(); }
+
+    private:
+
+        typedef typename std::conditional<L::isConstant, R, L>::type LeadType;
+
+        const LeadType &lead() const
+        { return Lead<L::isConstant>::get(lhs_, rhs_); }
+
+        L lhs_;
+
+        R rhs_;
+    };
+
+    //- Operand classification
+    enum OperandKind
+    {
+        NONE, FIELD, EXPRESSION, SCALAR, VECTOR
+    };
+
+    template<class T>
+    T fieldValueType(const FiniteVolumeField<T> *);
+
+    void fieldValueType(...);
+
+    template<class E>
+    std::true_type isExpression(const FieldExpression<E> *);
+
+    std::false_type isExpression(...);
+
+    template<class D>
+    struct Kind
+    {
+        static const OperandKind value =
+                !std::is_void<decltype(fieldValueType((const D *) nullptr))>::value ? FIELD :
+                decltype(isExpression((const D *) nullptr))::value ? EXPRESSION :
+                std::is_arithmetic<D>::value ? SCALAR :
+                std::is_same<D, Vector2D>::value ? VECTOR : NONE;
+    };
+
+    template<class A, class D = typename std::decay<A>::type, OperandKind kind = Kind<D>::value>
+    struct Operand
+    {
+    };
+
+    template<class A, class D>
+    struct Operand<A, D, FIELD>
+    {
+        typedef decltype(fieldValueType((const D *) nullptr)) ValueType;
+
+        typedef typename std::conditional<std::is_lvalue_reference<A>::value,
+                const FiniteVolumeField<ValueType> &,
+                FiniteVolumeField<ValueType>>::type Storage;
+
+        typedef FieldLeaf<ValueType, Storage> Type;
+
+        static Type make(A &&field)
+        { return Type(std::forward<A>(field)); }
+    };
+
+    template<class A, class D>
+    struct Operand<A, D, EXPRESSION>
+    {
+        typedef D Type;
+
+        static Type make(A &&e)
+        { return std::forward<A>(e); }
+    };
+
+    template<class A, class D>
+    struct Operand<A, D, SCALAR>
+    {
+        typedef Constant<Scalar> Type;
+
+        static Type make(A &&val)
+        { return Type(val); }
+    };
+
+    template<class A, class D>
+    struct Operand<A, D, VECTOR>
+    {
+        typedef Constant<Vector2D> Type;
+
+        static Type make(A &&val)
+        { return Type(val); }
+    };
+
+    //- At least one side must be a field or an expression
+    template<class L, class R>
+    struct IsFieldOperation
+    {
+        static const OperandKind lhs = Kind<typename std::decay<L>::type>::value;
+
+        static const OperandKind rhs = Kind<typename std::decay<R>::type>::value;
+
+        static const bool value = lhs != NONE && rhs != NONE
+                                  && (lhs == FIELD || lhs == EXPRESSION || rhs == FIELD || rhs == EXPRESSION);
+    };
+
+    template<class L, class R, class Op>
+    using BinaryType = typename std::enable_if<IsFieldOperation<L, R>::value,
+            Binary<typename Operand<L>::Type, typename Operand<R>::Type, Op>>::type;
+}
+
+//- External operators
+
+template<class L, class R>
+expr::BinaryType<L, R, expr::Add> operator+(L &&lhs, R &&rhs)
+{
+    return expr::BinaryType<L, R, expr::Add>(expr::Operand<L>::make(std::forward<L>(lhs)),
+                                             expr::Operand<R>::make(std::forward<R>(rhs)));
+}
+
+template<class L, class R>
+expr::BinaryType<L, R, expr::Subtract> operator-(L &&lhs, R &&rhs)
+{
+    return expr::BinaryType<L, R, expr::Subtract>(expr::Operand<L>::make(std::forward<L>(lhs)),
+                                                  expr::Operand<R>::make(std::forward<R>(rhs)));
+}
+
+template<class L, class R>
+expr::BinaryType<L, R, expr::Multiply> operator*(L &&lhs, R &&rhs)
+{
+    return expr::BinaryType<L, R, expr::Multiply>(expr::Operand<L>::make(std::forward<L>(lhs)),
+                                                  expr::Operand<R>::make(std::forward<R>(rhs)));
+}
+
+template<class L, class R>
+expr::BinaryType<L, R, expr::Divide> operator/(L &&lhs, R &&rhs)
+{
+    return expr::BinaryType<L, R, expr::Divide>(expr::Operand<L>::make(std::forward<L>(lhs)),
+                                                expr::Operand<R>::make(std::forward<R>(rhs)));
+}
+
+#endif
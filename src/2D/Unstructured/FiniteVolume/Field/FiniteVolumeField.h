@@ -4,6 +4,7 @@
 #include "System/Input.h"
 
 #include "Field.h"
+#include "FieldExpression.h"
 #include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
 #include "FiniteVolume/Equation/IndexMap.h"
 
@@ -39,6 +40,10 @@ public:
                                const std::shared_ptr<const CellGroup> &cellGroup = nullptr,
                                const std::shared_ptr<IndexMap> &indexMap = nullptr);
 
+    //- Evaluates a field expression into a new field on the grid of its leading operand
+    template<class E, class = typename std::enable_if<std::is_same<typename E::ValueType, T>::value>::type>
+    FiniteVolumeField(const FieldExpression<E> &expr);
+
     //- Initialization
     void fill(const T &val);
 
@@ -176,21 +181,27 @@ public:
     virtual void setIndexMap(const std::shared_ptr<IndexMap> &indexMap)
     { indexMap_ = indexMap; }
 
-    //- Field history
+    //- Field history, levels are reused once allocated and only their values are copied
     FiniteVolumeField &savePreviousTimeStep(Scalar timeStep, int nPreviousFields);
 
+    //- Rotates the history by swapping storage, the current values are stale afterwards and must be recomputed
+    FiniteVolumeField &rotatePreviousTimeStep(Scalar timeStep, int nPreviousFields);
+
     FiniteVolumeField &savePreviousIteration();
 
     void clearHistory();
 
     FiniteVolumeField &oldField(int i)
-    { return *previousTimeSteps_[i].second; }
+    { return *previousTimeSteps_[historyLevel(i)].second; }
 
     const FiniteVolumeField &oldField(int i) const
-    { return *previousTimeSteps_[i].second; }
+    { return *previousTimeSteps_[historyLevel(i)].second; }
 
     Scalar oldTimeStep(int i) const
-    { return previousTimeSteps_[i].first; }
+    { return previousTimeSteps_[historyLevel(i)].first; }
+
+    Size nOldFields() const
+    { return previousTimeSteps_.size(); }
 
     const FiniteVolumeField &prevIteration() const
     { return *previousIteration_; }
@@ -201,6 +212,9 @@ public:
 
     //- Operators
 
+    template<class E>
+    FiniteVolumeField &operator=(const FieldExpression<E> &expr);
+
     FiniteVolumeField &operator+=(const FiniteVolumeField &rhs);
 
     FiniteVolumeField &operator-=(const FiniteVolumeField &rhs);
@@ -234,6 +248,13 @@ protected:
 
     void setBoundaryRefValues(const Input &input);
 
+    Label historyLevel(int i) const
+    { return (historyHead_ + i) % previousTimeSteps_.size(); }
+
+    std::shared_ptr<FiniteVolumeField<T>> advanceHistory(Scalar timeStep, int nPreviousFields);
+
+    void copyValues(const FiniteVolumeField<T> &other);
+
     //- Data members
     std::unordered_map<std::string, std::pair<BoundaryType, T> > patchBoundaries_;
 
@@ -246,8 +267,10 @@ protected:
     //- Misc data
     std::vector<T> faces_, nodes_;
 
-    //- Field history
-    std::deque<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
+    //- Field history, a ring whose newest level is at historyHead_
+    std::vector<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
+
+    Label historyHead_ = 0;
 
     std::shared_ptr<FiniteVolumeField<T>> previousIteration_;
 
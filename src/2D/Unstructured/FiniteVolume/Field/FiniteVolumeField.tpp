@@ -1,4 +1,5 @@
 #include <fstream>
+#include <algorithm>
 
 #include <boost/algorithm/string.hpp>
 
@@ -84,6 +85,21 @@ void FiniteVolumeField<T>::fillInterior(const T &val)
     }
 }
 
+template<class T>
+template<class E, class>
+FiniteVolumeField<T>::FiniteVolumeField(const FieldExpression<E> &expr)
+    :
+      FiniteVolumeField(expr.self().grid(),
+                        expr.self().name(),
+                        T(),
+                        expr.self().hasFaces(),
+                        expr.self().hasNodes(),
+                        nullptr,
+                        expr.self().indexMap())
+{
+    *this = expr;
+}
+
 template<class T>
 void FiniteVolumeField<T>::assign(const FiniteVolumeField<T> &field)
 {
@@ -208,33 +224,43 @@ void FiniteVolumeField<T>::interpolateNodes()
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousTimeStep(Scalar timeStep, int nPreviousFields)
 {
-    std::shared_ptr<FiniteVolumeField<T>> tmp;
+    Size nLevels = previousTimeSteps_.size();
+    std::shared_ptr<FiniteVolumeField<T>> level = advanceHistory(timeStep, nPreviousFields);
 
-    if(previousTimeSteps_.size() >= nPreviousFields)
-    {
-        tmp = previousTimeSteps_.back().second;
-        *tmp = *this;
-    }
-    else
-        tmp = std::make_shared<FiniteVolumeField<T>>(*this);
+    //- New levels are created as copies
+    if(previousTimeSteps_.size() <= nLevels)
+        level->copyValues(*this);
 
-    tmp->clearHistory();
+    return *level;
+}
+
+template<class T>
+FiniteVolumeField<T> &FiniteVolumeField<T>::rotatePreviousTimeStep(Scalar timeStep, int nPreviousFields)
+{
+    Size nLevels = previousTimeSteps_.size();
+    std::shared_ptr<FiniteVolumeField<T>> level = advanceHistory(timeStep, nPreviousFields);
 
-    previousTimeSteps_.emplace_front(timeStep, tmp);
-    previousTimeSteps_.resize(nPreviousFields, previousTimeSteps_.back());
+    if(previousTimeSteps_.size() <= nLevels)
+    {
+        std::vector<T>::swap(*level);
+        faces_.swap(level->faces_);
+        nodes_.swap(level->nodes_);
+    }
 
-    return *previousTimeSteps_.front().second;
+    return *level;
 }
 
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousIteration()
 {
     if(previousIteration_)
-        *previousIteration_ = *this;
+        previousIteration_->copyValues(*this);
     else
+    {
         previousIteration_ = std::make_shared<FiniteVolumeField<T>>(*this);
+        previousIteration_->clearHistory();
+    }
 
-    previousIteration_->clearHistory();
     return *previousIteration_;
 }
 
@@ -243,6 +269,46 @@ void FiniteVolumeField<T>::clearHistory()
 {
     previousIteration_ = nullptr;
     previousTimeSteps_.clear();
+    historyHead_ = 0;
+}
+
+//- Protected
+
+template<class T>
+std::shared_ptr<FiniteVolumeField<T>> FiniteVolumeField<T>::advanceHistory(Scalar timeStep, int nPreviousFields)
+{
+    //- A missing level is allocated once, as a copy inserted at the head of the ring
+    if(previousTimeSteps_.size() < nPreviousFields)
+    {
+        auto level = std::make_shared<FiniteVolumeField<T>>(*this);
+        level->clearHistory();
+
+        previousTimeSteps_.insert(previousTimeSteps_.begin() + historyHead_, std::make_pair(timeStep, level));
+        return level;
+    }
+
+    //- Excess levels are the oldest ones
+    if(previousTimeSteps_.size() > nPreviousFields)
+    {
+        std::rotate(previousTimeSteps_.begin(), previousTimeSteps_.begin() + historyHead_, previousTimeSteps_.end());
+        previousTimeSteps_.resize(nPreviousFields);
+        historyHead_ = 0;
+    }
+
+    //- The oldest level becomes the newest
+    historyHead_ = (historyHead_ + previousTimeSteps_.size() - 1) % previousTimeSteps_.size();
+    previousTimeSteps_[historyHead_].first = timeStep;
+
+    return previousTimeSteps_[historyHead_].second;
+}
+
+template<class T>
+void FiniteVolumeField<T>::copyValues(const FiniteVolumeField<T> &other)
+{
+    //- Only values, sizes match so no storage is reallocated
+    std::vector<T>::operator=(other);
+    faces_ = other.faces_;
+    nodes_ = other.nodes_;
 }
 
 //- Parallel
@@ -391,6 +457,26 @@ FiniteVolumeField<T> &FiniteVolumeField<T>::operator/=(Scalar rhs)
     return *this;
 }
 
+template<class T>
+template<class E>
+FiniteVolumeField<T> &FiniteVolumeField<T>::operator=(const FieldExpression<E> &expr)
+{
+    const E &e = expr.self();
+
+    for (Label id = 0; id < this->size(); ++id)
+        std::vector<T>::operator[](id) = e.cell(id);
+
+    if (hasFaces() && e.hasFaces())
+        for (Label id = 0; id < faces_.size(); ++id)
+            faces_[id] = e.face(id);
+
+    if (hasNodes() && e.hasNodes())
+        for (Label id = 0; id < nodes_.size(); ++id)
+            nodes_[id] = e.node(id);
+
+    return *this;
+}
+
 template<class T>
 void FiniteVolumeField<T>::setGrid(const std::shared_ptr<const FiniteVolumeGrid2D> &grid)
 {
@@ -476,40 +562,3 @@ void FiniteVolumeField<T>::setBoundaryTypes(const Input &input)
         patchBoundaries_[patch.name()] = std::make_pair(boundaryType, T());
     }
 }
-
-//- External operators
-
-template<class T>
-FiniteVolumeField<T> operator+(FiniteVolumeField<T> lhs, const FiniteVolumeField<T> &rhs)
-{
-    lhs += rhs;
-    return lhs;
-}
-
-template<class T>
-FiniteVolumeField<T> operator-(FiniteVolumeField<T> lhs, const FiniteVolumeField<T> &rhs)
-{
-    lhs -= rhs;
-    return lhs;
-}
-
-template<class T>
-FiniteVolumeField<T> operator*(FiniteVolumeField<T> lhs, Scalar rhs)
-{
-    lhs *= rhs;
-    return lhs;
-}
-
-template<class T>
-FiniteVolumeField<T> operator*(Scalar lhs, FiniteVolumeField<T> rhs)
-{
-    rhs *= lhs;
-    return rhs;
-}
-
-template<class T>
-FiniteVolumeField<T> operator/(FiniteVolumeField<T> lhs, Scalar rhs)
-{
-    lhs /= rhs;
-    return lhs;
-}
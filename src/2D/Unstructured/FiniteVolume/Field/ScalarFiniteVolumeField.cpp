@@ -45,44 +45,3 @@ bool ScalarFiniteVolumeField::isfinite() const
 
     return bool(grid_->comm().min(isFinite));
 }
-
-//- External functions
-
-ScalarFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, ScalarFiniteVolumeField rhs)
-{
-    rhs *= lhs;
-    return rhs;
-}
-
-ScalarFiniteVolumeField operator-(const ScalarFiniteVolumeField &lhs, Scalar rhs)
-{
-    ScalarFiniteVolumeField diff(lhs.grid(), "", 0., false);
-
-    std::transform(lhs.begin(), lhs.end(), diff.begin(), [rhs](Scalar val) {
-        return val - rhs;
-    });
-
-    return lhs;
-}
-
-ScalarFiniteVolumeField operator/(ScalarFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs)
-{
-    lhs /= rhs;
-    return lhs;
-}
-
-ScalarFiniteVolumeField operator/(Scalar lhs, ScalarFiniteVolumeField rhs)
-{
-    for (const Cell &cell: rhs.grid()->cells())
-        rhs(cell) = lhs / rhs(cell);
-
-    if (rhs.hasFaces())
-        for (const Face &face: rhs.grid()->faces())
-            rhs(face) = lhs / rhs(face);
-
-    if (rhs.hasNodes())
-        for (const Node &node: rhs.grid()->nodes())
-            rhs(node) = lhs / rhs(node);
-
-    return rhs;
-}
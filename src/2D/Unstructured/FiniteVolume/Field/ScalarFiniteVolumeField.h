@@ -9,13 +9,4 @@ typedef FiniteVolumeField<Scalar> ScalarFiniteVolumeField;
 template<>
 void ScalarFiniteVolumeField::setBoundaryRefValues(const Input &input);
 
-//- External
-ScalarFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, ScalarFiniteVolumeField rhs);
-
-ScalarFiniteVolumeField operator-(const ScalarFiniteVolumeField &lhs, Scalar rhs);
-
-ScalarFiniteVolumeField operator/(ScalarFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs);
-
-ScalarFiniteVolumeField operator/(Scalar lhs, ScalarFiniteVolumeField rhs);
-
 #endif
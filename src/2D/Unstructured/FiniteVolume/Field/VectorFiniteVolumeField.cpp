@@ -192,36 +192,3 @@ bool VectorFiniteVolumeField::isfinite() const
 
     return bool(grid_->comm().min(isFinite));
 }
-
-//- External functions
-
-VectorFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, VectorFiniteVolumeField rhs)
-{
-    rhs *= lhs;
-    return rhs;
-}
-
-VectorFiniteVolumeField operator*(VectorFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs)
-{
-    lhs *= rhs;
-    return lhs;
-}
-
-VectorFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, const Vector2D &rhs)
-{
-    VectorFiniteVolumeField result(lhs.grid(), lhs.name());
-
-    for (const Cell &cell: lhs.grid()->cells())
-        result[cell.id()] = lhs[cell.id()] * rhs;
-
-    for (const Face &face: lhs.grid()->faces())
-        result.faces()[face.id()] = lhs.faces()[face.id()] * rhs;
-
-    return result;
-}
-
-VectorFiniteVolumeField operator/(VectorFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs)
-{
-    lhs /= rhs;
-    return lhs;
-}
@@ -53,13 +53,4 @@ void VectorFiniteVolumeField::setBoundaryRefValues(const Input &input);
 template<>
 void VectorFiniteVolumeField::setBoundaryFaces();
 
-//- External
-VectorFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, VectorFiniteVolumeField rhs);
-
-VectorFiniteVolumeField operator*(VectorFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs);
-
-VectorFiniteVolumeField operator*(const ScalarFiniteVolumeField &lhs, const Vector2D &rhs);
-
-VectorFiniteVolumeField operator/(VectorFiniteVolumeField lhs, const ScalarFiniteVolumeField &rhs);
-
 #endif
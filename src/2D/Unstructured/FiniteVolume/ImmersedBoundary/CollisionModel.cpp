@@ -1,8 +1,6 @@
 #include <algorithm>
 
 #include "CollisionModel.h"
-#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
-#include "FiniteVolumeGrid2D/Face/FaceGroup.h"
 
 CollisionModel::CollisionModel(Scalar eps_particle, Scalar range_particle, Scalar eps_wall, Scalar range_wall)
 {
@@ -33,7 +31,7 @@ Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObjP, const Immer
         throw Exception("CollisionModel", "force", "unsupported shape type.");
 }
 
-Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid) const
+Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const BoundaryFaceIndex &walls) const
 {
     Vector2D fc = Vector2D(0., 0.);
     Vector2D fc_zero = Vector2D(0.0, 0.0);
@@ -46,17 +44,13 @@ Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const Finite
         const Vector2D &xp = c.centroid();
         Scalar r = c.radius();
 
-        for (const FaceGroup &p: grid.patches())
-            for (const Face &f: p.itemsCoveredBy(Circle(xp, r + range_wall_)))
-            {
-                if(!grid.localCells().isInSet(f.lCell()))
-                    continue;
+        for (const BoundaryFaceIndex::WallSegment &seg: walls.segmentsWithin(Circle(xp, r + range_wall_)))
+        {
+            const Vector2D xq = seg.nearestPoint(xp);
+            Scalar d = (xp - xq).mag();
 
-                const Vector2D &xq = f.centroid();
-                Scalar d = (xp - xq).mag();
-
-                fc += (xp - xq) / eps_wall_ * pow(r + range_wall_ - d, 2);
-            }
+            fc += (xp - xq) / eps_wall_ * pow(r + range_wall_ - d, 2);
+        }
         break;
     }
     default:
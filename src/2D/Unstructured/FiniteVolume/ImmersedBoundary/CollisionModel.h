@@ -1,6 +1,8 @@
 #ifndef PHASE_COLLISION_MODEL_H
 #define PHASE_COLLISION_MODEL_H
 
+#include "FiniteVolumeGrid2D/Face/BoundaryFaceIndex.h"
+
 #include "ImmersedBoundaryObject.h"
 
 class CollisionModel
@@ -11,7 +13,7 @@ public:
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObjP, const ImmersedBoundaryObject& ibObjQ) const;
 
-    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
+    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const BoundaryFaceIndex& walls) const;
 
     Scalar eps() const
     { return eps_particle_; }
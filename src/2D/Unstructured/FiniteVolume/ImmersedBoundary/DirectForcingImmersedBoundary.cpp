@@ -16,6 +16,7 @@ void DirectForcingImmersedBoundary::updateCells()
 {
     localIbCells_.clear();
     localSolidCells_.clear();
+    compatGeometry_.clear();
 
     cellStatus_->fill(FLUID_CELLS);
 
@@ -33,6 +34,16 @@ void DirectForcingImmersedBoundary::updateCells()
 
     cellStatus_->sendMessages();
 
+    //- Classify every cell centroid in one batch, neighbours are then looked up by id
+    std::vector<Point2D> centroids;
+    centroids.reserve(grid_->cells().size());
+
+    for(const Cell &c: grid_->cells())
+        centroids.push_back(c.centroid());
+
+    std::vector<std::shared_ptr<ImmersedBoundaryObject>> cellIbObjs;
+    findIbObjs(centroids, cellIbObjs);
+
     for(const Cell &c: *domainCells_)
     {
         if((*cellStatus_)(c) == SOLID_CELLS)
@@ -40,11 +51,13 @@ void DirectForcingImmersedBoundary::updateCells()
 
         for(const CellLink &nb: c.neighbours())
         {
-            if(ibObj(nb.cell().centroid()))
+            const auto &nbIbObj = cellIbObjs[nb.cell().id()];
+
+            if(nbIbObj)
             {
                 if(localIbCells_.add(c))
                 {
-                    ibObj(nb.cell())->addIbCell(c);
+                    nbIbObj->addIbCell(c);
                     (*cellStatus_)(c) = IB_CELLS;
                 }
                 break;
@@ -473,6 +486,9 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                                            const ScalarFiniteVolumeField &p,
                                                            const Vector2D &g)
 {
+    if(distributed_)
+        throw Exception("DirectForcingImmersedBoundary", "applyHydrodynamicForce", "not supported for distributed immersed boundaries.");
+
     struct Stress
     {
         Point2D pt;
@@ -675,6 +691,9 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVol
                                                            const ScalarFiniteVolumeField &p,
                                                            const Vector2D &g)
 {
+    if(distributed_)
+        throw Exception("DirectForcingImmersedBoundary", "applyHydrodynamicForce", "not supported for distributed immersed boundaries.");
+
     struct Stress
     {
         Point2D pt;
@@ -850,17 +869,16 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVol
 
 void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho, const VectorFiniteVolumeField &fib, const Vector2D &g)
 {
-    for(const auto &ibObj: ibObjs_)
-    {
-        Vector2D f = Vector2D(0., 0.);
+    std::vector<Vector2D> f(ibObjs_.size(), Vector2D(0., 0.));
 
-        for(const Cell &c: ibObj->cells())
-            f -= rho * fib(c) * c.volume();
+    for(Label i = 0; i < ibObjs_.size(); ++i)
+        for(const Cell &c: ibObjs_[i]->cells())
+            f[i] -= rho * fib(c) * c.volume();
 
-        f = grid_->comm().sum(f);
-        f += (ibObj->rho - rho) * g * ibObj->shape().area();
-        ibObj->applyForce(f);
-    }
+    f = sum(f);
+
+    for(Label i = 0; i < ibObjs_.size(); ++i)
+        ibObjs_[i]->applyForce(f[i] + (ibObjs_[i]->rho - rho) * g * ibObjs_[i]->shape().area());
 }
 
 void DirectForcingImmersedBoundary::applyHydrodynamicForce(const VectorFiniteVolumeField &fib)
@@ -868,6 +886,23 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const VectorFiniteVol
     applyHydrodynamicForce(1., fib);
 }
 
+//- Private
+
+const DirectForcingImmersedBoundary::CompatGeometry &DirectForcingImmersedBoundary::compatGeometry(const Cell &cell,
+                                                                                                   const ImmersedBoundaryObject &ibObj) const
+{
+    std::vector<CompatGeometry> &geometries = compatGeometry_[cell.id()];
+
+    for(const CompatGeometry &geom: geometries)
+        if(geom.ibObj == &ibObj)
+            return geom;
+
+    Point2D pt = ibObj.nearestIntersect(cell.centroid());
+    geometries.push_back(CompatGeometry{&ibObj, pt, ibObj.nearestEdgeUnitNormal(pt)});
+
+    return geometries.back();
+}
+
 //void DirectForcingImmersedBoundary::rce(const ScalarFiniteVolumeField &rho,
 //                                                       const ScalarFiniteVolumeField &mu,
 //                                                       const VectorFiniteVolumeField &u,
@@ -1,6 +1,8 @@
 #ifndef PHASE_DIRECT_FORCING_IMMERSED_BOUNDARY_H
 #define PHASE_DIRECT_FORCING_IMMERSED_BOUNDARY_H
 
+#include <unordered_map>
+
 #include "Geometry/Tensor2D.h"
 #include "Math/StaticMatrix.h"
 #include "Math/Matrix.h"
@@ -79,6 +81,20 @@ public:
 
 private:
 
+    //- Nearest surface point and normal of an ib object seen from a cell centroid, valid until the next updateCells
+    struct CompatGeometry
+    {
+        const ImmersedBoundaryObject *ibObj;
+
+        Point2D pt;
+
+        Vector2D ns;
+    };
+
+    const CompatGeometry &compatGeometry(const Cell &cell, const ImmersedBoundaryObject &ibObj) const;
+
+    mutable std::unordered_map<Label, std::vector<CompatGeometry>> compatGeometry_;
+
     CellGroup localIbCells_, localSolidCells_;
 
     CellGroup globalIbCells_, globalSolidCells_;
@@ -6,8 +6,13 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_A;
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_b;
 
+const Scalar DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_minRcond = 1e-10;
+
 DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadraticStencil(const Cell &cell,
                                                                                           const DirectForcingImmersedBoundary &ib)
+    :
+      _x0(cell.centroid()),
+      _h(0.)
 {
     _ibObjSets[0].clear();
     for(const CellLink &nb: cell.neighbours())
@@ -16,7 +21,7 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
 
         if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) == _ibObjSets[0].end())
         {
-            _compatPts.push_back(CompatPoint(cell, *ibObj));
+            _compatPts.push_back(CompatPoint(cell, ib.compatGeometry(cell, *ibObj)));
             _ibObjSets[0].emplace_back(ibObj.get());
         }
         else
@@ -49,7 +54,7 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
             if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) != _ibObjSets[0].end()
                     && std::find(_ibObjSets[1].begin(), _ibObjSets[1].end(), ibObj.get()) == _ibObjSets[1].end())
             {
-                _compatPts.push_back(CompatPoint(*stCell, *ibObj));
+                _compatPts.push_back(CompatPoint(*stCell, ib.compatGeometry(*stCell, *ibObj)));
                 _ibObjSets[1].emplace_back(ibObj.get());
             }
         }
@@ -69,6 +74,15 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
                         + std::to_string(nReconstructionPoints()) + "."
                         + " Num cells = " + std::to_string(_cells.size())
                         + ", Num compat pts = " + std::to_string(_compatPts.size()) + ".");
+
+    for(const Cell *stCell: _cells)
+        _h = std::max(_h, (stCell->centroid() - _x0).mag());
+
+    for(const CompatPoint &cpt: _compatPts)
+        _h = std::max(_h, (cpt.pt() - _x0).mag());
+
+    for(const Face *face: _faces)
+        _h = std::max(_h, (face->centroid() - _x0).mag());
 }
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::interpolationCoeffs(const Point2D &x) const
@@ -86,64 +100,66 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::continuityCo
     return quadraticContinuityConstrainedInterpolationCoeffs(pt);
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterpolationCoeffs(const Point2D &x) const
+Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterpolationCoeffs(const Point2D &pt) const
 {
+    Vector2D x = local(pt);
+
     _A.resize(nReconstructionPoints(), 3);
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
-        const Point2D &x = cell->centroid();
+        Vector2D x = local(cell->centroid());
         _A.setRow(i++, {x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
-        const Point2D &x = cpt.pt();
+        Vector2D x = local(cpt.pt());
         _A.setRow(i++, {x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
-        const Point2D &x = face->centroid();
+        Vector2D x = local(face->centroid());
         _A.setRow(i++, {x.x, x.y, 1.});
     }
 
     _b.resize(1, 3);
     _b.setRow(0, {x.x, x.y, 1.});
-    _A.pinvert();
 
-    return _b * _A;
+    return leastSquaresCoeffs();
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticInterpolationCoeffs(const Point2D &x) const
+Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticInterpolationCoeffs(const Point2D &pt) const
 {
+    Vector2D x = local(pt);
+
     _A.resize(nReconstructionPoints(), 6);
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
-        const Point2D &x = cell->centroid();
+        Vector2D x = local(cell->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
-        const Point2D &x = cpt.pt();
+        Vector2D x = local(cpt.pt());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
-        const Point2D &x = face->centroid();
+        Vector2D x = local(face->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     _b.resize(1, 6);
     _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
 
-    return _b * _A;
+    return leastSquaresCoeffs();
 }
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::subgridInterpolationCoeffs(const Point2D &x) const
@@ -159,79 +175,91 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::subgridInter
     return Matrix(1, 2, {g, 1. - g});
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
+Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticContinuityConstrainedInterpolationCoeffs(const Point2D &pt) const
 {
+    Vector2D x = local(pt);
+
     _A.resize(2 * nReconstructionPoints() + 1, 12);
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
-        const Point2D &x = cell->centroid();
+        Vector2D x = local(cell->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
-        const Point2D &x = cpt.pt();
+        Vector2D x = local(cpt.pt());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
-        const Point2D &x = face->centroid();
+        Vector2D x = local(face->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
+    //- Derivatives pick up a factor 1/h from the coordinate scaling
     _A.setRow(i, {2 * x.x, 0., x.y, 1., 0., 0.,
                   0., 2 * x.y, x.x, 0., 1., 0.});
+    _A.scaleRow(i, 1. / _h);
 
     _b.resize(2, 12);
     _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
     _b.setRow(1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
 
-    return _b * _A;
+    return leastSquaresCoeffs();
 }
 
-Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const
+Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &pt) const
 {
+    Vector2D x = local(pt);
+
     _A.resize(2 * nReconstructionPoints() + 1, 12);
 
     int i = 0;
     for(const Cell *cell: _cells)
     {
-        const Point2D &x = cell->centroid();
+        Vector2D x = local(cell->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const CompatPoint &cpt: _compatPts)
     {
-        const Point2D &x = cpt.pt();
+        Vector2D x = local(cpt.pt());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
     for(const Face *face: _faces)
     {
-        const Point2D &x = face->centroid();
+        Vector2D x = local(face->centroid());
         _A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
         _A.setRow(i++, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
     }
 
-    Scalar r = x.x;
-    Scalar z = x.y;
+    //- du/dr + u/r + dv/dz, with u/r using the physical radius
+    Scalar r = pt.x;
 
-    _A.setRow(i, {3. * r * r / r, z * z / r, 2. * r * z / r, 2. * r / r, z / r, 1. / r,
-                  0., 2 * z, r, 0., 1., 0.});
+    _A.setRow(i, {x.x * x.x / r + 2. * x.x / _h, x.y * x.y / r, x.x * x.y / r + x.y / _h, x.x / r + 1. / _h, x.y / r, 1. / r,
+                  0., 2. * x.y / _h, x.x / _h, 0., 1. / _h, 0.});
 
     _b.resize(2, 12);
     _b.setRow(0, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1., 0., 0., 0., 0., 0., 0.});
     _b.setRow(1, {0., 0., 0., 0., 0., 0., x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-    _A.pinvert();
+
+    return leastSquaresCoeffs();
+}
+
+Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::leastSquaresCoeffs() const
+{
+    if(!_A.choleskyPinvert(_minRcond))
+        _A.pinvert();
 
     return _b * _A;
 }
@@ -17,7 +17,11 @@ public:
         {}
 
         CompatPoint(const Cell &cell, const ImmersedBoundaryObject &ibObj)
-            : _cell(&cell), _ibObj(&ibObj), _pt(ibObj.nearestIntersect(cell.centroid()))
+            : _cell(&cell), _ibObj(&ibObj), _pt(ibObj.nearestIntersect(cell.centroid())), _ns(ibObj.nearestEdgeUnitNormal(_pt))
+        {}
+
+        CompatPoint(const Cell &cell, const CompatGeometry &geom)
+            : _cell(&cell), _ibObj(geom.ibObj), _pt(geom.pt), _ns(geom.ns)
         {}
 
         Vector2D velocity() const
@@ -35,8 +39,8 @@ public:
         const Point2D &pt() const
         { return _pt; }
 
-        Vector2D ns() const
-        { return _ibObj->nearestEdgeUnitNormal(_pt); }
+        const Vector2D &ns() const
+        { return _ns; }
 
     private:
 
@@ -45,6 +49,8 @@ public:
         const ImmersedBoundaryObject *_ibObj;
 
         Point2D _pt;
+
+        Vector2D _ns;
     };
 
     LeastSquaresQuadraticStencil(const Cell &cell,
@@ -75,6 +81,15 @@ protected:
 
     static Matrix _A, _b;
 
+    //- Below this reciprocal condition number of A^T A the QR pseudo-inverse is used instead of Cholesky
+    static const Scalar _minRcond;
+
+    //- Rows are assembled in coordinates centred on the stencil cell and scaled by the stencil radius
+    Vector2D local(const Point2D &x) const
+    { return (x - _x0) / _h; }
+
+    Matrix leastSquaresCoeffs() const;
+
     Matrix linearInterpolationCoeffs(const Point2D &x) const;
 
     Matrix quadraticInterpolationCoeffs(const Point2D &x) const;
@@ -88,6 +103,10 @@ protected:
     StaticVector<const Face*, 8> _faces;
 
     StaticVector<CompatPoint, 8> _compatPts;
+
+    Point2D _x0;
+
+    Scalar _h;
 };
 
 #endif
@@ -114,6 +114,9 @@ void GhostCellImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                                        const ScalarFiniteVolumeField &p,
                                                        const Vector2D &g)
 {
+    if(distributed_)
+        throw Exception("GhostCellImmersedBoundary", "applyHydrodynamicForce", "not supported for distributed immersed boundaries.");
+
     std::vector<std::tuple<Point2D, Scalar, Scalar>> stresses;
 
     for(auto &ibObj: ibObjs_)
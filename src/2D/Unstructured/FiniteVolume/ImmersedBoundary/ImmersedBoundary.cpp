@@ -1,4 +1,6 @@
 #include <fstream>
+#include <cstring>
+#include <unordered_map>
 
 #include "FiniteVolume/Motion/TranslatingMotion.h"
 #include "FiniteVolume/Motion/OscillatingMotion.h"
@@ -158,6 +160,7 @@ ImmersedBoundary::ImmersedBoundary(const Input &input,
                 throw Exception("ImmersedBoundary", "ImmersedBoundary", "invalid motion type \"" + motionType + "\".");
 
             ibObj->setMotion(motion);
+            ibObj->setId(ibObjs_.size());
             ibObjs_.emplace_back(ibObj);
         }
 
@@ -165,32 +168,29 @@ ImmersedBoundary::ImmersedBoundary(const Input &input,
 
     if(ibInput)
     {
-        std::string filename = ibInput.get().get<std::string>("filename");
-
-        for(const auto &ibObjInput: input.read(filename))
-        {
-            std::string name = ibObjInput.first;
-            auto ibObj = std::make_shared<ImmersedBoundaryObject>(name);
-
-            ibObj->initCircle(
-                        ibObjInput.second.get<std::string>("geometry.center"),
-                        ibObjInput.second.get<Scalar>("geometry.radius")
-                        );
-
-            //- Init bcs, set the defaults first
-            for(const auto &ibFieldBcInput: ibInput.get().get_child("fields"))
+        ibFileInput_ = ibInput.get();
+        distributed_ = ibFileInput_.get<bool>("distributed", false) && grid_->comm().nProcs() > 1;
+        haloWidth_ = ibFileInput_.get<Scalar>("haloWidth", 0.);
+
+        if(distributed_)
+            initDistributedIbObjs(input);
+        else
+            for(const auto &ibObjInput: input.read(ibFileInput_.get<std::string>("filename")))
             {
-                ibObj->addBoundaryCondition(ibFieldBcInput.first,
-                                            ibFieldBcInput.second.get<std::string>("type"),
-                                            ibFieldBcInput.second.get<std::string>("value"));
-            }
+                auto ibObj = createFileIbObj(ibObjInput.first,
+                                             ibObjInput.second.get<std::string>("geometry.center"),
+                                             ibObjInput.second.get<Scalar>("geometry.radius"));
 
-            ibObjs_.emplace_back(ibObj);
-        }
+                ibObj->setId(ibObjs_.size());
+                ibObjs_.emplace_back(ibObj);
+            }
     }
 
     grid_->comm().printf("Assembling immersed boundary r-tree...\n");
-    rTree_.insert(ibObjs_.begin(), ibObjs_.end());
+    updateRTree();
+
+    grid_->comm().printf("Assembling boundary face index...\n");
+    wallIndex_.init(*grid_);
 
     //- Collision model
     // collisionModel_ = std::make_shared<CollisionModel>(
@@ -213,6 +213,21 @@ ImmersedBoundary::ImmersedBoundary(const Input &input,
                 input.boundaryInput().get<Scalar>("ImmersedBoundaries.Lubrication.ParticleRange", 0.05),
                 input.boundaryInput().get<Scalar>("ImmersedBoundaries.Lubrication.WallRange", 0.)
                 );
+
+    //- DEM sub-stepping
+    demSubStepping_ = input.boundaryInput().get<bool>("ImmersedBoundaries.Collisions.SubStepping", false);
+    demSubSteps_ = input.boundaryInput().get<int>("ImmersedBoundaries.Collisions.SubSteps", 0);
+    demStepsPerContact_ = input.boundaryInput().get<int>("ImmersedBoundaries.Collisions.StepsPerContact", 20);
+    demMaxSubSteps_ = input.boundaryInput().get<int>("ImmersedBoundaries.Collisions.MaxSubSteps", 1000);
+
+    //- Lubrication is only applied by solvers calling applyLubricationForce, sub-stepping it is opt-in
+    demLubrication_ = demSubStepping_
+            && input.boundaryInput().get<bool>("ImmersedBoundaries.Lubrication.SubStepping", false);
+
+    if (demLubrication_)
+        grid_->comm().printf("Collision and lubrication forces will be sub-stepped within each time step.\n");
+    else if (demSubStepping_)
+        grid_->comm().printf("Collision forces will be sub-stepped within each time step.\n");
 }
 
 void ImmersedBoundary::setDomainCells(const std::shared_ptr<CellGroup> &domainCells)
@@ -243,24 +258,14 @@ CellGroup ImmersedBoundary::solidCells() const
 
 std::shared_ptr<ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Point2D &pt)
 {
-    namespace bgi = boost::geometry::index;
-
-    for(auto qit = rTree_.qbegin(bgi::intersects(pt)); qit != rTree_.qend(); ++qit)
-        if((*qit)->isInIb(pt))
-            return *qit;
-
-    return nullptr;
+    Index i = shapes_.isInside(pt);
+    return i < 0 ? nullptr : ibObjs_[i];
 }
 
 std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Point2D &pt) const
 {
-    namespace bgi = boost::geometry::index;
-
-    for(auto qit = rTree_.qbegin(bgi::intersects(pt)); qit != rTree_.qend(); ++qit)
-        if((*qit)->isInIb(pt))
-            return *qit;
-
-    return nullptr;
+    Index i = shapes_.isInside(pt);
+    return i < 0 ? nullptr : ibObjs_[i];
 }
 
 std::shared_ptr<ImmersedBoundaryObject> ImmersedBoundary::ibObj(const Cell &cell)
@@ -280,23 +285,23 @@ std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::nearestIbObjSurf
 
 const std::vector<std::shared_ptr<const ImmersedBoundaryObject> > &ImmersedBoundary::findAllIbObjs(const Point2D &pt) const
 {
-    namespace bgi = boost::geometry::index;
+    shapes_.allInside(pt, shapeQuery_);
 
-    auto isInside = [&pt](const std::shared_ptr<ImmersedBoundaryObject>& ibObj)
-    { return ibObj->isInIb(pt); };
+    query_.clear();
+    for(Label i: shapeQuery_)
+        query_.push_back(ibObjs_[i]);
 
-    query_.assign(rTree_.qbegin(bgi::intersects(pt) && bgi::satisfies(isInside)), rTree_.qend());
     return query_;
 }
 
 const std::vector<std::shared_ptr<const ImmersedBoundaryObject> > &ImmersedBoundary::findAllIbObjs(const Circle &c) const
 {
-    namespace bgi = boost::geometry::index;
+    shapes_.surfacesWithin(c.centroid(), c.radius(), shapeQuery_);
 
-    auto intersects = [&c](const std::shared_ptr<ImmersedBoundaryObject>& ibObj)
-    { return (ibObj->nearestIntersect(c.centroid()) - c.centroid()).magSqr() <= std::pow(c.radius(), 2); };
+    query_.clear();
+    for(Label i: shapeQuery_)
+        query_.push_back(ibObjs_[i]);
 
-    query_.assign(rTree_.qbegin(bgi::intersects(c.boundingBox()) && bgi::satisfies(intersects)), rTree_.qend());
     return query_;
 }
 
@@ -308,24 +313,12 @@ std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::nearestIbObj(con
 std::pair<std::shared_ptr<const ImmersedBoundaryObject>, Point2D>
 ImmersedBoundary::nearestIntersect(const Point2D &pt) const
 {
-    std::shared_ptr<const ImmersedBoundaryObject> nearestIbObj = nullptr;
-    Point2D minXc;
-    Scalar minDistSqr = std::numeric_limits<Scalar>::infinity();
-
-    for (const auto &ibObj: *this)
-    {
-        Point2D xc = ibObj->nearestIntersect(pt);
-        Scalar distSqr = (xc - pt).magSqr();
+    auto xc = shapes_.nearestIntersect(pt);
 
-        if (distSqr < minDistSqr)
-        {
-            nearestIbObj = ibObj;
-            minXc = xc;
-            minDistSqr = distSqr;
-        }
-    }
+    if(xc.first < 0)
+        return std::make_pair(nullptr, xc.second);
 
-    return std::make_pair(nearestIbObj, minXc);
+    return std::make_pair(ibObjs_[xc.first], xc.second);
 }
 
 std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const std::string &name) const
@@ -337,10 +330,125 @@ std::shared_ptr<const ImmersedBoundaryObject> ImmersedBoundary::ibObj(const std:
     throw Exception("ImmersedBoundary", "ibObj", "no immersed boundary object named \"" + name + "\".");
 }
 
+void ImmersedBoundary::findIbObjs(const std::vector<Point2D> &pts, std::vector<std::shared_ptr<ImmersedBoundaryObject>> &result)
+{
+    std::vector<Index> ids;
+    shapes_.isInside(pts, ids);
+
+    result.resize(pts.size());
+
+    for(Label i = 0; i < pts.size(); ++i)
+        result[i] = ids[i] < 0 ? nullptr : ibObjs_[ids[i]];
+}
+
+void ImmersedBoundary::nearestIntersects(const std::vector<Point2D> &pts,
+                                         std::vector<std::pair<std::shared_ptr<const ImmersedBoundaryObject>, Point2D>> &result) const
+{
+    std::vector<std::pair<Index, Point2D>> xcs;
+    shapes_.nearestIntersect(pts, xcs);
+
+    result.resize(pts.size());
+
+    for(Label i = 0; i < pts.size(); ++i)
+        result[i] = std::make_pair(xcs[i].first < 0 ? nullptr : ibObjs_[xcs[i].first], xcs[i].second);
+}
+
+std::vector<ImmersedBoundary::IbObjectState> ImmersedBoundary::checkpointStates() const
+{
+    std::vector<IbObjectState> states;
+
+    for (const auto &ibObj: ibObjs_)
+        if (isOutputProc(*ibObj))
+            states.push_back(packState(*ibObj));
+
+    return states;
+}
+
+void ImmersedBoundary::restoreStates(const std::vector<IbObjectState> &states)
+{
+    std::unordered_map<Label, const IbObjectState*> stateIds;
+
+    for (const IbObjectState &state: states)
+        stateIds[state.id] = &state;
+
+    //- Objects held by every process are updated in place
+    std::vector<std::shared_ptr<ImmersedBoundaryObject>> ibObjs;
+
+    for (const auto &ibObj: ibObjs_)
+        if (!distributed_ || ibObj->isReplicated())
+        {
+            auto it = stateIds.find(ibObj->id());
+
+            if (it != stateIds.end())
+            {
+                unpackState(*it->second, *ibObj);
+                stateIds.erase(it);
+            }
+
+            ibObjs.push_back(ibObj);
+        }
+
+    if (!distributed_)
+    {
+        updateRTree();
+        return;
+    }
+
+    //- Distributed objects are recreated by the processes whose halo holds their restored position
+    const Communicator &comm = grid_->comm();
+
+    for (const IbObjectState &state: states)
+        if (stateIds.find(state.id) != stateIds.end() && isInHalo(Circle(state.pos, state.radius), comm.rank()))
+        {
+            auto ibObj = createFileIbObj(state.name, state.pos, state.radius);
+            unpackState(state, *ibObj);
+            ibObj->setId(state.id);
+            ibObj->setOwner(comm.mainProcNo());
+            ibObjs.push_back(ibObj);
+        }
+
+    ibObjs_ = ibObjs;
+    ++syncNo_;
+
+    updateOwnership();
+    updateRTree();
+}
+
 void ImmersedBoundary::updateIbPositions(Scalar timeStep)
 {
-    for(const auto& ibObj: ibObjs_)
-        ibObj->updatePosition(timeStep);
+    if(demSubStepping_ && collisionModel_)
+        updateIbPositionsDem(timeStep);
+    else
+        for(const auto& ibObj: ibObjs_)
+            if(isOwned(*ibObj))
+                ibObj->updatePosition(timeStep);
+
+    //- Ghost copies are refreshed from their owners
+    if(distributed_)
+        syncDistributedIbObjs();
+    else
+        updateRTree();
+}
+
+int ImmersedBoundary::nDemSubSteps(Scalar timeStep) const
+{
+    if (demSubSteps_ > 0)
+        return demSubSteps_;
+
+    //- Resolve the soft-sphere contact time t_c = pi * sqrt(m_eff / k) with a fixed number of sub-steps
+    Scalar k = std::max(collisionModel_->k(), collisionModel_->kWall());
+    Scalar minMass = std::numeric_limits<Scalar>::infinity();
+
+    for (const auto &ibObj: ibObjs_)
+        if (std::dynamic_pointer_cast<const SolidBodyMotion>(ibObj->motion()))
+            minMass = std::min(minMass, ibObj->mass());
+
+    if (k <= 0. || std::isinf(minMass))
+        return 1;
+
+    Scalar tc = M_PI * std::sqrt(minMass / (2. * k));
+
+    return std::max(1, std::min(demMaxSubSteps_, (int) std::ceil(demStepsPerContact_ * timeStep / tc)));
 }
 
 FiniteVolumeEquation<Vector2D> ImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u) const
@@ -375,62 +483,141 @@ void ImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho
 
 void ImmersedBoundary::applyCollisionForce(bool add)
 {
+    //- Contact forces are integrated in updateIbPositions when sub-stepping
+    if(demSubStepping_)
+        return;
+
     if(collisionModel_)
-        for (auto ibObjP: ibObjs_)
+    {
+        std::vector<Vector2D> fc(ibObjs_.size(), Vector2D(0., 0.));
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
         {
             //- Dont compute if no motion
-            if(!ibObjP->motion())
+            if(!ibObjs_[i]->motion())
                 continue;
 
-            if(ibObjP->shape().type() != Shape2D::CIRCLE)
+            if(ibObjs_[i]->shape().type() != Shape2D::CIRCLE)
             {
                 grid_->comm().printf("Non-circular shapes are not supported for collisions.\n");
                 continue;
             }
 
-            Vector2D fc = grid_->comm().sum(collisionModel_->force(*ibObjP, *grid_));
+            fc[i] = collisionModel_->force(*ibObjs_[i], wallIndex_);
+        }
+
+        fc = sum(fc);
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+        {
+            auto ibObjP = ibObjs_[i];
+
+            if(!ibObjP->motion() || ibObjP->shape().type() != Shape2D::CIRCLE)
+                continue;
 
             const Circle &circle = static_cast<const Circle&>(ibObjP->shape());
 
             //- Collisions with particles
             for (auto ibObjQ: findAllIbObjs(Circle(circle.centroid(), circle.radius() + collisionModel_->range())))
-                fc += collisionModel_->force(*ibObjP, *ibObjQ);
+                fc[i] += collisionModel_->force(*ibObjP, *ibObjQ);
 
             if(add)
-                ibObjP->addForce(fc);
+                ibObjP->addForce(fc[i]);
             else
-                ibObjP->applyForce(fc);
+                ibObjP->applyForce(fc[i]);
         }
+    }
 }
 
 void ImmersedBoundary::applyLubricationForce(bool add)
 {
+    //- Lubrication forces are integrated in updateIbPositions when sub-stepped
+    if(demLubrication_)
+        return;
+
     if(collisionModel_)
-        for (auto ibObjP: ibObjs_)
+    {
+        std::vector<Vector2D> f_lubrication(ibObjs_.size(), Vector2D(0., 0.));
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
         {
             //- Dont compute if no motion
-            if(!ibObjP->motion())
+            if(!ibObjs_[i]->motion())
                 continue;
 
-            if(ibObjP->shape().type() != Shape2D::CIRCLE)
+            if(ibObjs_[i]->shape().type() != Shape2D::CIRCLE)
             {
                 grid_->comm().printf("Non-circular shapes are not supported for collisions.\n");
                 continue;
             }
 
-            Vector2D f_lubrication = grid_->comm().sum(lubricationCorrection_->force(*ibObjP, *grid_));
+            f_lubrication[i] = lubricationCorrection_->force(*ibObjs_[i], wallIndex_);
+        }
+
+        f_lubrication = sum(f_lubrication);
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+        {
+            auto ibObjP = ibObjs_[i];
+
+            if(!ibObjP->motion() || ibObjP->shape().type() != Shape2D::CIRCLE)
+                continue;
 
             const Circle &circle = static_cast<const Circle&>(ibObjP->shape());
 
             //- Collisions with particles
             for (auto ibObjQ: findAllIbObjs(Circle(circle.centroid(), circle.radius() + lubricationCorrection_->range_particle())))
-                f_lubrication += lubricationCorrection_->force(*ibObjP, *ibObjQ);
+                f_lubrication[i] += lubricationCorrection_->force(*ibObjP, *ibObjQ);
 
             if(add)
-                ibObjP->addForce(f_lubrication);
+                ibObjP->addForce(f_lubrication[i]);
             else
-                ibObjP->applyForce(f_lubrication);
+                ibObjP->applyForce(f_lubrication[i]);
+        }
+    }
+}
+
+std::vector<Vector2D> ImmersedBoundary::sum(const std::vector<Vector2D> &vals) const
+{
+    if(!distributed_)
+        return grid_->comm().sum(vals);
+
+    const Communicator &comm = grid_->comm();
+    std::vector<Vector2D> result(vals), replicatedVals;
+
+    //- Replicated objects are held by every process and are reduced globally
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+        if(ibObjs_[i]->isReplicated())
+            replicatedVals.push_back(vals[i]);
+
+    replicatedVals = comm.sum(replicatedVals);
+
+    //- Ghost contributions are sent to the owner only
+    std::vector<std::vector<std::pair<Label, Vector2D>>> sendBufs(comm.nProcs());
+    std::unordered_map<Label, Label> index;
+
+    for (Label i = 0, j = 0; i < ibObjs_.size(); ++i)
+    {
+        const ImmersedBoundaryObject &ibObj = *ibObjs_[i];
+
+        if(ibObj.isReplicated())
+            result[i] = replicatedVals[j++];
+        else if(ibObj.owner() == comm.rank())
+            index[ibObj.id()] = i;
+        else
+            sendBufs[ibObj.owner()].push_back(std::make_pair(ibObj.id(), vals[i]));
+    }
+
+    for (const auto &recvBuf: exchange(sendBufs))
+        for (const auto &val: recvBuf)
+        {
+            auto it = index.find(val.first);
+
+            if(it != index.end())
+                result[it->second] += val.second;
         }
+
+    return result;
 }
 
 
@@ -448,3 +635,359 @@ void ImmersedBoundary::setCellStatus()
 
     grid_->sendMessages(*cellStatus_);
 }
+
+void ImmersedBoundary::updateIbPositionsDem(Scalar timeStep)
+{
+    int nSubSteps = nDemSubSteps(timeStep);
+    Scalar dt = timeStep / nSubSteps;
+
+    grid_->comm().printf("Integrating particle contacts with %d sub-steps, sub-step = %.4e...\n", nSubSteps, dt);
+
+    //- The hydrodynamic force is held fixed over the fluid time step, it is the applied force of each object
+    for (int step = 0; step < nSubSteps; ++step)
+    {
+        //- Velocity-Verlet position update, prescribed motions are advanced alongside. Ghost objects are not integrated
+        for (const auto &ibObj: ibObjs_)
+        {
+            if (!isOwned(*ibObj))
+                continue;
+
+            auto motion = std::dynamic_pointer_cast<SolidBodyMotion>(ibObj->motion());
+
+            if (motion)
+            {
+                motion->updatePosition(dt);
+                ibObj->shape().move(motion->position());
+            }
+            else
+                ibObj->updatePosition(dt);
+        }
+
+        if (distributed_)
+            syncDistributedIbObjs();
+        else
+            updateRTree();
+
+        //- Contact forces at the new positions, then the velocity update
+        std::vector<Vector2D> fc = contactForces();
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+        {
+            auto motion = std::dynamic_pointer_cast<SolidBodyMotion>(ibObjs_[i]->motion());
+
+            if (motion && isOwned(*ibObjs_[i]))
+                motion->updateVelocity(dt, ibObjs_[i]->force() + fc[i]);
+        }
+    }
+}
+
+std::vector<Vector2D> ImmersedBoundary::contactForces() const
+{
+    std::vector<Vector2D> fc(ibObjs_.size(), Vector2D(0., 0.));
+
+    auto hasContacts = [](const ImmersedBoundaryObject &ibObj)
+    { return ibObj.motion() && ibObj.shape().type() == Shape2D::CIRCLE; };
+
+    //- Wall contacts are only computed by the process owning the wall face, reduce them all at once
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+        if (hasContacts(*ibObjs_[i]))
+        {
+            fc[i] += collisionModel_->force(*ibObjs_[i], wallIndex_);
+
+            if (demLubrication_)
+                fc[i] += lubricationCorrection_->force(*ibObjs_[i], wallIndex_);
+        }
+
+    fc = sum(fc);
+
+    //- Particle contacts
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+    {
+        const auto &ibObjP = ibObjs_[i];
+
+        if (!hasContacts(*ibObjP))
+            continue;
+
+        const Circle &circle = static_cast<const Circle&>(ibObjP->shape());
+
+        for (auto ibObjQ: findAllIbObjs(Circle(circle.centroid(), circle.radius() + collisionModel_->range())))
+            if (ibObjQ != ibObjP)
+                fc[i] += collisionModel_->force(*ibObjP, *ibObjQ);
+
+        if (!demLubrication_)
+            continue;
+
+        for (auto ibObjQ: findAllIbObjs(Circle(circle.centroid(), circle.radius() + lubricationCorrection_->range_particle())))
+            if (ibObjQ != ibObjP)
+                fc[i] += lubricationCorrection_->force(*ibObjP, *ibObjQ);
+    }
+
+    return fc;
+}
+
+void ImmersedBoundary::updateRTree()
+{
+    shapes_.clear();
+
+    for(const auto &ibObj: ibObjs_)
+        shapes_.add(ibObj->shape());
+
+    shapes_.init();
+}
+
+std::shared_ptr<ImmersedBoundaryObject> ImmersedBoundary::createFileIbObj(const std::string &name,
+                                                                          const Point2D &center,
+                                                                          Scalar radius) const
+{
+    auto ibObj = std::make_shared<ImmersedBoundaryObject>(name);
+
+    ibObj->initCircle(center, radius);
+    ibObj->rho = ibFileInput_.get<Scalar>("properties.rho", 0.);
+
+    //- Init bcs, set the defaults first
+    for(const auto &ibFieldBcInput: ibFileInput_.get_child("fields"))
+    {
+        ibObj->addBoundaryCondition(ibFieldBcInput.first,
+                                    ibFieldBcInput.second.get<std::string>("type"),
+                                    ibFieldBcInput.second.get<std::string>("value"));
+    }
+
+    std::string motionType = ibFileInput_.get<std::string>("motion.type", "none");
+
+    if (motionType == "solidBody" || motionType == "solid-body")
+        ibObj->setMotion(std::make_shared<SolidBodyMotion>(
+                             ibObj,
+                             ibFileInput_.get<std::string>("motion.velocity", "(0,0)"),
+                             (bool)ibFileInput_.get_child_optional("motion.axis"),
+                             ibFileInput_.get<std::string>("motion.axis", "(0,1)")
+                             ));
+    else if (motionType != "none")
+        throw Exception("ImmersedBoundary", "createFileIbObj", "invalid motion type \"" + motionType + "\".");
+
+    return ibObj;
+}
+
+void ImmersedBoundary::initDistributedIbObjs(const Input &input)
+{
+    const Communicator &comm = grid_->comm();
+
+    comm.printf("Distributing immersed boundary objects from file \"%s\"...\n",
+                ibFileInput_.get<std::string>("filename").c_str());
+
+    procBoxes_ = comm.allGather(grid_->boundingBox());
+
+    //- Only the main process reads the file, each process is sent the objects that overlap its halo
+    std::vector<std::vector<IbObjectState>> sendBufs(comm.nProcs());
+    std::vector<unsigned long> sizes(comm.nProcs(), 0);
+
+    if (comm.isMainProc())
+    {
+        Label id = ibObjs_.size();
+
+        for (const auto &ibObjInput: input.read(ibFileInput_.get<std::string>("filename")))
+        {
+            IbObjectState state;
+
+            state.id = id++;
+            std::strncpy(state.name, ibObjInput.first.c_str(), sizeof(state.name) - 1);
+            state.name[sizeof(state.name) - 1] = '\0';
+            state.pos = Point2D(ibObjInput.second.get<std::string>("geometry.center"));
+            state.radius = ibObjInput.second.get<Scalar>("geometry.radius");
+            state.rho = ibFileInput_.get<Scalar>("properties.rho", 0.);
+            state.vel = state.acc = state.force = Vector2D(0., 0.);
+            state.theta = state.omega = state.alpha = state.motionTime = 0.;
+
+            maxRadius_ = std::max(maxRadius_, state.radius);
+
+            for (int proc = 0; proc < comm.nProcs(); ++proc)
+                if (isInHalo(Circle(state.pos, state.radius), proc))
+                    sendBufs[proc].push_back(state);
+        }
+
+        for (int proc = 0; proc < comm.nProcs(); ++proc)
+            sizes[proc] = sendBufs[proc].size();
+    }
+
+    maxRadius_ = comm.broadcast(comm.mainProcNo(), maxRadius_);
+    comm.broadcast(comm.mainProcNo(), sizes);
+
+    std::vector<IbObjectState> states(sizes[comm.rank()]);
+
+    if (comm.isMainProc())
+    {
+        for (int proc = 0; proc < comm.nProcs(); ++proc)
+            if (proc != comm.rank())
+                comm.isend(proc, sendBufs[proc], 0);
+
+        states = sendBufs[comm.rank()];
+        comm.waitAll();
+    }
+    else
+        comm.recv(comm.mainProcNo(), states, 0);
+
+    //- Processes exchange objects with those within reach of an object overlapping both halos
+    Scalar reach = 2. * (maxRadius_ + haloWidth_);
+
+    for (int proc = 0; proc < comm.nProcs(); ++proc)
+        if (proc != comm.rank() && procBoxes_[proc].distance(procBoxes_[comm.rank()]) <= reach)
+            neighbourProcs_.push_back(proc);
+
+    for (const IbObjectState &state: states)
+    {
+        auto ibObj = createFileIbObj(state.name, state.pos, state.radius);
+        unpackState(state, *ibObj);
+        ibObj->setId(state.id);
+        ibObj->setOwner(comm.mainProcNo());
+        ibObjs_.emplace_back(ibObj);
+    }
+
+    updateOwnership();
+
+    unsigned long nOwned = 0;
+
+    for (const auto &ibObj: ibObjs_)
+        if (!ibObj->isReplicated() && isOwned(*ibObj))
+            ++nOwned;
+
+    comm.printf("Distributed %lu immersed boundary objects, halo width = %lf, max radius = %lf.\n",
+                comm.sum(nOwned), haloWidth_, maxRadius_);
+}
+
+void ImmersedBoundary::syncDistributedIbObjs()
+{
+    const Communicator &comm = grid_->comm();
+
+    //- Owners send their objects to every process whose halo they overlap
+    std::vector<std::vector<IbObjectState>> sendBufs(comm.nProcs());
+
+    for (const auto &ibObj: ibObjs_)
+        if (!ibObj->isReplicated() && ibObj->owner() == comm.rank())
+            for (int proc: neighbourProcs_)
+                if (isInHalo(static_cast<const Circle&>(ibObj->shape()), proc))
+                    sendBufs[proc].push_back(packState(*ibObj));
+
+    auto recvBufs = exchange(sendBufs);
+
+    //- Keep replicated and owned objects, ghosts are reused if they are received again and dropped otherwise
+    std::vector<std::shared_ptr<ImmersedBoundaryObject>> ibObjs;
+    std::unordered_map<Label, std::shared_ptr<ImmersedBoundaryObject>> ghosts;
+
+    for (const auto &ibObj: ibObjs_)
+        if (ibObj->isReplicated())
+            ibObjs.push_back(ibObj);
+        else if (ibObj->owner() == comm.rank())
+        {
+            if (isInHalo(static_cast<const Circle&>(ibObj->shape()), comm.rank()))
+                ibObjs.push_back(ibObj);
+        }
+        else
+            ghosts[ibObj->id()] = ibObj;
+
+    for (int proc: neighbourProcs_)
+        for (const IbObjectState &state: recvBufs[proc])
+        {
+            auto it = ghosts.find(state.id);
+            auto ibObj = it != ghosts.end() ? it->second : createFileIbObj(state.name, state.pos, state.radius);
+
+            unpackState(state, *ibObj);
+            ibObj->setId(state.id);
+            ibObj->setOwner(proc);
+            ibObjs.push_back(ibObj);
+        }
+
+    ibObjs_ = ibObjs;
+    ++syncNo_;
+
+    updateOwnership();
+    updateRTree();
+}
+
+void ImmersedBoundary::updateOwnership()
+{
+    const Communicator &comm = grid_->comm();
+
+    //- An object is claimed by the process holding the cell containing its centroid, lowest rank wins ties
+    std::vector<std::pair<Label, int>> claims;
+    std::unordered_map<Label, std::pair<int, int>> owners;
+
+    for (const auto &ibObj: ibObjs_)
+    {
+        if (ibObj->isReplicated())
+            continue;
+
+        bool isInLocalCell = false;
+
+        for (const Cell &cell: grid_->localCells().nearestItems(ibObj->position(), 4))
+            if (cell.isInCell(ibObj->position()))
+            {
+                isInLocalCell = true;
+                break;
+            }
+
+        //- Objects whose centroid is not claimed remain with their previous owner
+        int priority = isInLocalCell ? 0 : (ibObj->owner() == comm.rank() ? 1 : 2);
+
+        claims.push_back(std::make_pair(ibObj->id(), priority));
+        owners[ibObj->id()] = std::make_pair(priority, comm.rank());
+    }
+
+    std::vector<std::vector<std::pair<Label, int>>> sendBufs(comm.nProcs());
+
+    for (int proc: neighbourProcs_)
+        sendBufs[proc] = claims;
+
+    auto recvBufs = exchange(sendBufs);
+
+    for (int proc: neighbourProcs_)
+        for (const auto &claim: recvBufs[proc])
+        {
+            auto it = owners.find(claim.first);
+
+            if (it != owners.end())
+                it->second = std::min(it->second, std::make_pair(claim.second, proc));
+        }
+
+    for (const auto &ibObj: ibObjs_)
+        if (!ibObj->isReplicated())
+            ibObj->setOwner(owners[ibObj->id()].second);
+}
+
+bool ImmersedBoundary::isInHalo(const Circle &circle, int proc) const
+{
+    return procBoxes_[proc].distance(circle.centroid()) <= circle.radius() + haloWidth_;
+}
+
+ImmersedBoundary::IbObjectState ImmersedBoundary::packState(const ImmersedBoundaryObject &ibObj) const
+{
+    IbObjectState state;
+
+    state.id = ibObj.id();
+    std::strncpy(state.name, ibObj.name().c_str(), sizeof(state.name) - 1);
+    state.name[sizeof(state.name) - 1] = '\0';
+    state.pos = ibObj.position();
+    state.radius = ibObj.shape().type() == Shape2D::CIRCLE ? static_cast<const Circle&>(ibObj.shape()).radius() : 0.;
+    state.rho = ibObj.rho;
+    state.vel = ibObj.motion() ? ibObj.motion()->velocity() : Vector2D(0., 0.);
+    state.acc = ibObj.motion() ? ibObj.motion()->acceleration() : Vector2D(0., 0.);
+    state.force = ibObj.force();
+    state.theta = ibObj.motion() ? ibObj.motion()->theta() : 0.;
+    state.omega = ibObj.motion() ? ibObj.motion()->omega() : 0.;
+    state.alpha = ibObj.motion() ? ibObj.motion()->alpha() : 0.;
+    state.motionTime = ibObj.motion() ? ibObj.motion()->time() : 0.;
+
+    return state;
+}
+
+void ImmersedBoundary::unpackState(const IbObjectState &state, ImmersedBoundaryObject &ibObj) const
+{
+    ibObj.shape().move(state.pos);
+    ibObj.rho = state.rho;
+
+    if (ibObj.motion())
+    {
+        ibObj.motion()->init(state.pos, state.vel, state.acc, state.theta, state.omega, state.alpha);
+        ibObj.motion()->setTime(state.motionTime);
+    }
+
+    ibObj.applyForce(state.force);
+}
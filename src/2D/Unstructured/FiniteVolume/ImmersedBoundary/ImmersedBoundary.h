@@ -4,6 +4,7 @@
 #include "FiniteVolume/Field/ScalarFiniteVolumeField.h"
 #include "FiniteVolume/Field/VectorFiniteVolumeField.h"
 #include "FiniteVolume/Equation/FiniteVolumeEquation.h"
+#include "Geometry/ShapeCollection.h"
 #include "ImmersedBoundaryObject.h"
 #include "CollisionModel.h"
 #include "SoftSphereCollisionModel.h"
@@ -13,26 +14,25 @@ class ImmersedBoundary
 {
 public:
 
-    typedef boost::geometry::index::quadratic<8, 4> Parameters;
-
-    struct IndexableGetter
+    enum Type
     {
-        typedef boost::geometry::model::box<Point2D> result_type;
-
-        result_type operator()(const std::shared_ptr<ImmersedBoundaryObject> &ibObj) const
-        { return ibObj->shape().boundingBox(); }
+        FLUID_CELLS = 1, IB_CELLS = 2, SOLID_CELLS = 3, FRESH_CELLS = 4
     };
 
-    struct EqualTo
+    //- Used to communicate distributed immersed boundary objects
+    struct IbObjectState
     {
-        bool operator()(const std::shared_ptr<ImmersedBoundaryObject> &lhs, const std::shared_ptr<ImmersedBoundaryObject> &rhs) const
-        { return lhs == rhs; }
-    };
+        Label id;
 
+        char name[64];
 
-    enum Type
-    {
-        FLUID_CELLS = 1, IB_CELLS = 2, SOLID_CELLS = 3, FRESH_CELLS = 4
+        Point2D pos;
+
+        Scalar radius, rho;
+
+        Vector2D vel, acc, force;
+
+        Scalar theta, omega, alpha, motionTime;
     };
 
     ImmersedBoundary(const Input &input,
@@ -75,6 +75,12 @@ public:
 
     std::shared_ptr<const ImmersedBoundaryObject> ibObj(const std::string &name) const;
 
+    //- Batched queries, one result per point
+    void findIbObjs(const std::vector<Point2D> &pts, std::vector<std::shared_ptr<ImmersedBoundaryObject>> &result);
+
+    void nearestIntersects(const std::vector<Point2D> &pts,
+                           std::vector<std::pair<std::shared_ptr<const ImmersedBoundaryObject>, Point2D>> &result) const;
+
     const std::vector<std::shared_ptr<ImmersedBoundaryObject>> &ibObjs() const
     { return ibObjs_; }
 
@@ -84,9 +90,38 @@ public:
     std::vector<std::shared_ptr<ImmersedBoundaryObject>>::const_iterator end() const
     { return ibObjs_.end(); }
 
+    //- Parallel
+    bool isDistributed() const
+    { return distributed_; }
+
+    //- Number of exchanges of distributed objects, the set of objects held only changes with it
+    Size syncNo() const
+    { return syncNo_; }
+
+    bool isOwned(const ImmersedBoundaryObject &ibObj) const
+    { return ibObj.isReplicated() || ibObj.owner() == grid_->comm().rank(); }
+
+    //- Replicated objects are written by the main process, distributed ones by their owner
+    bool isOutputProc(const ImmersedBoundaryObject &ibObj) const
+    { return ibObj.isReplicated() ? grid_->comm().isMainProc() : ibObj.owner() == grid_->comm().rank(); }
+
+    //- Per-object reductions, the result for a distributed object is only complete on its owner
+    std::vector<Vector2D> sum(const std::vector<Vector2D> &vals) const;
+
+    template<class T>
+    std::vector<std::vector<T>> gather(const std::vector<std::vector<T>> &vals) const;
+
+    //- Checkpoints, the states of the objects this process writes out, and their restoration from the
+    //  states of all objects
+    std::vector<IbObjectState> checkpointStates() const;
+
+    void restoreStates(const std::vector<IbObjectState> &states);
+
     //- Updates
     virtual void updateIbPositions(Scalar timeStep);
 
+    int nDemSubSteps(Scalar timeStep) const;
+
     virtual void updateCells() = 0;
 
     //- Boundary conditions
@@ -129,8 +164,34 @@ protected:
 
     mutable std::vector<std::shared_ptr<const ImmersedBoundaryObject>> query_;
 
+    mutable std::vector<Label> shapeQuery_;
+
     void setCellStatus();
 
+    void updateIbPositionsDem(Scalar timeStep);
+
+    std::vector<Vector2D> contactForces() const;
+
+    void updateRTree();
+
+    //- Distributed objects
+    std::shared_ptr<ImmersedBoundaryObject> createFileIbObj(const std::string &name, const Point2D &center, Scalar radius) const;
+
+    void initDistributedIbObjs(const Input &input);
+
+    void syncDistributedIbObjs();
+
+    void updateOwnership();
+
+    bool isInHalo(const Circle &circle, int proc) const;
+
+    IbObjectState packState(const ImmersedBoundaryObject &ibObj) const;
+
+    void unpackState(const IbObjectState &state, ImmersedBoundaryObject &ibObj) const;
+
+    template<class T>
+    std::vector<std::vector<T>> exchange(std::vector<std::vector<T>> &sendBufs) const;
+
     std::shared_ptr<CellGroup> domainCells_;
 
     std::shared_ptr<FiniteVolumeField<int>> cellStatus_;
@@ -139,8 +200,24 @@ protected:
 
     std::vector<std::shared_ptr<ImmersedBoundaryObject>> ibObjs_;
 
-    //- Fast searching
-    boost::geometry::index::rtree<std::shared_ptr<ImmersedBoundaryObject>, Parameters, IndexableGetter, EqualTo> rTree_;
+    //- Distributed mode, geometry file objects are only held by processes whose halo they overlap
+    bool distributed_ = false;
+
+    Size syncNo_ = 0;
+
+    Scalar haloWidth_ = 0., maxRadius_ = 0.;
+
+    boost::property_tree::ptree ibFileInput_;
+
+    std::vector<BoundingBox> procBoxes_;
+
+    std::vector<int> neighbourProcs_;
+
+    //- Fast searching, object shapes are indexed in the same order as ibObjs_
+    ShapeCollection shapes_;
+
+    //- Boundary face segments for wall collisions, built once per grid
+    BoundaryFaceIndex wallIndex_;
 
     //- Collision model 
     // std::shared_ptr<CollisionModel> collisionModel_;
@@ -150,6 +227,14 @@ protected:
 
     //- Lubrication model
     std::shared_ptr<LubricationCorrection> lubricationCorrection_;
+
+    //- DEM sub-stepping of contact forces, a sub-step count of 0 selects it automatically. Lubrication
+    //  forces are only sub-stepped when enabled separately
+    bool demSubStepping_, demLubrication_;
+
+    int demSubSteps_, demStepsPerContact_, demMaxSubSteps_;
 };
 
+#include "ImmersedBoundary.tpp"
+
 #endif
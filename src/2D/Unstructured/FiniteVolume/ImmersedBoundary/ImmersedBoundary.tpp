@@ -0,0 +1,73 @@
+#include <unordered_map>
+
+template<class T>
+std::vector<std::vector<T>> ImmersedBoundary::gather(const std::vector<std::vector<T>> &vals) const
+{
+    const Communicator &comm = grid_->comm();
+
+    std::vector<std::vector<T>> result(vals.size());
+    std::vector<std::vector<std::pair<Label, T>>> sendBufs(comm.nProcs());
+
+    for (Label i = 0; i < vals.size(); ++i)
+    {
+        const ImmersedBoundaryObject &ibObj = *ibObjs_[i];
+
+        if (ibObj.isReplicated())
+            result[i] = comm.allGatherv(vals[i]);
+        else if (ibObj.owner() == comm.rank())
+            result[i] = vals[i];
+        else
+            for (const T &val: vals[i])
+                sendBufs[ibObj.owner()].push_back(std::make_pair(ibObj.id(), val));
+    }
+
+    if (!distributed_)
+        return result;
+
+    std::unordered_map<Label, Label> index;
+
+    for (Label i = 0; i < ibObjs_.size(); ++i)
+        index[ibObjs_[i]->id()] = i;
+
+    for (const auto &recvBuf: exchange(sendBufs))
+        for (const auto &val: recvBuf)
+        {
+            auto it = index.find(val.first);
+
+            if (it != index.end())
+                result[it->second].push_back(val.second);
+        }
+
+    return result;
+}
+
+template<class T>
+std::vector<std::vector<T>> ImmersedBoundary::exchange(std::vector<std::vector<T>> &sendBufs) const
+{
+    const Communicator &comm = grid_->comm();
+
+    std::vector<std::vector<unsigned long>> sendSizes(comm.nProcs()), recvSizes(comm.nProcs());
+    std::vector<std::vector<T>> recvBufs(comm.nProcs());
+
+    //- Sizes first, then the data
+    for (int proc: neighbourProcs_)
+    {
+        sendSizes[proc].assign(1, sendBufs[proc].size());
+        recvSizes[proc].resize(1);
+        comm.irecv(proc, recvSizes[proc], 0);
+        comm.isend(proc, sendSizes[proc], 0);
+    }
+
+    comm.waitAll();
+
+    for (int proc: neighbourProcs_)
+    {
+        recvBufs[proc].resize(recvSizes[proc][0]);
+        comm.irecv(proc, recvBufs[proc], 1);
+        comm.isend(proc, sendBufs[proc], 1);
+    }
+
+    comm.waitAll();
+
+    return recvBufs;
+}
@@ -24,6 +24,22 @@ public:
     const std::string &name() const
     { return _name; }
 
+    //- Parallel info, objects without an owner are replicated on every process
+    Label id() const
+    { return _id; }
+
+    void setId(Label id)
+    { _id = id; }
+
+    int owner() const
+    { return _owner; }
+
+    void setOwner(int owner)
+    { _owner = owner; }
+
+    bool isReplicated() const
+    { return _owner < 0; }
+
     //- Cell methods
     std::vector<Ref<const Cell>> cellsWithin(const CellGroup &domainCells) const
     { return domainCells.itemsWithin(*_shape); }
@@ -168,6 +184,10 @@ protected:
     //- Identification
     std::string _name;
 
+    Label _id = 0;
+
+    int _owner = -1;
+
     CellGroup _cells, _ibCells, _solidCells;
 
     //- Boundary type info
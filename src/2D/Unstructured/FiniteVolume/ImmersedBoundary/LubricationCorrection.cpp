@@ -2,8 +2,6 @@
 #include <math.h>
 
 #include "LubricationCorrection.h"
-#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
-#include "FiniteVolumeGrid2D/Face/FaceGroup.h"
 
 LubricationCorrection::LubricationCorrection(Scalar mu, Scalar range_particle, Scalar range_wall)
 {
@@ -46,7 +44,7 @@ Vector2D LubricationCorrection::force(const ImmersedBoundaryObject &ibObjP, cons
         throw Exception("CollisionModel", "force", "unsupported shape type.");
 }
 
-Vector2D LubricationCorrection::force(const ImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid) const
+Vector2D LubricationCorrection::force(const ImmersedBoundaryObject &ibObj, const BoundaryFaceIndex &walls) const
 {
     Vector2D f_lubrication = Vector2D(0., 0.);
     Vector2D f_zero = Vector2D(0.0, 0.0);
@@ -60,24 +58,20 @@ Vector2D LubricationCorrection::force(const ImmersedBoundaryObject &ibObj, const
         const Vector2D &vp = ibObj.velocity(xp);
         Scalar r = c.radius();
 
-        for (const FaceGroup &p: grid.patches())
-            for (const Face &f: p.itemsCoveredBy(Circle(xp, r + range_wall_)))
-            {
-                if(!grid.localCells().isInSet(f.lCell()))
-                    continue;
+        for (const BoundaryFaceIndex::WallSegment &seg: walls.segmentsWithin(Circle(xp, r + range_wall_)))
+        {
+            const Vector2D xq = seg.nearestPoint(xp);
+            Scalar d = (xp - xq).mag();
+            Vector2D norm_d = (xp - xq) / d;
+            Scalar delta = r + range_particle_ - d;
+            Scalar epsilon = delta / r;
+            Scalar epsilon_0 = range_particle_ / r;
+            Scalar lambda = 1/(epsilon) - (1/5) * log (epsilon) - (1/21) * epsilon * log (epsilon);
+            Scalar lambda_0 = 1/(epsilon_0) - (1/5) * log (epsilon_0) - (1/21) * epsilon_0 * log (epsilon_0);
 
-                const Vector2D &xq = f.centroid();
-                Scalar d = (xp - xq).mag();
-                Vector2D norm_d = (xp - xq) / d;
-                Scalar delta = r + range_particle_ - d;
-                Scalar epsilon = delta / r;
-                Scalar epsilon_0 = range_particle_ / r;
-                Scalar lambda = 1/(epsilon) - (1/5) * log (epsilon) - (1/21) * epsilon * log (epsilon);
-                Scalar lambda_0 = 1/(epsilon_0) - (1/5) * log (epsilon_0) - (1/21) * epsilon_0 * log (epsilon_0);
-
-                f_lubrication = 6 * M_PI * mu_ * r * (vp) * (lambda - lambda_0);
-                f_lubrication += 6 * M_PI * mu_ * r * (vp) * (lambda - lambda_0);
-            }
+            f_lubrication = 6 * M_PI * mu_ * r * (vp) * (lambda - lambda_0);
+            f_lubrication += 6 * M_PI * mu_ * r * (vp) * (lambda - lambda_0);
+        }
         break;
     }
     default:
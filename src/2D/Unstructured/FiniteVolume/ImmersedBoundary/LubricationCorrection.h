@@ -1,6 +1,8 @@
 #ifndef PHASE_LUBRICATION_CORRECTION_H
 #define PHASE_LUBRICATION_CORRECTION_H
 
+#include "FiniteVolumeGrid2D/Face/BoundaryFaceIndex.h"
+
 #include "ImmersedBoundaryObject.h"
 
 class LubricationCorrection
@@ -11,7 +13,7 @@ public:
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObjP, const ImmersedBoundaryObject& ibObjQ) const;
 
-    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
+    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const BoundaryFaceIndex& walls) const;
 
     Scalar range_particle() const
     { return range_particle_; }
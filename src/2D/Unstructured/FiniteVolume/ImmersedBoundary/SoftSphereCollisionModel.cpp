@@ -1,8 +1,6 @@
 #include <algorithm>
 
 #include "SoftSphereCollisionModel.h"
-#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
-#include "FiniteVolumeGrid2D/Face/FaceGroup.h"
 
 SoftSphereCollisionModel::SoftSphereCollisionModel(Scalar k_particle, Scalar eta_particle, Scalar range_particle, Scalar k_wall, Scalar eta_wall, Scalar range_wall)
 {
@@ -42,7 +40,7 @@ Vector2D SoftSphereCollisionModel::force(const ImmersedBoundaryObject &ibObjP, c
         throw Exception("CollisionModel", "force", "unsupported shape type.");
 }
 
-Vector2D SoftSphereCollisionModel::force(const ImmersedBoundaryObject &ibObj, const FiniteVolumeGrid2D &grid) const
+Vector2D SoftSphereCollisionModel::force(const ImmersedBoundaryObject &ibObj, const BoundaryFaceIndex &walls) const
 {
     Vector2D fc = Vector2D(0., 0.);
     Vector2D fc_zero = Vector2D(0.0, 0.0);
@@ -56,17 +54,13 @@ Vector2D SoftSphereCollisionModel::force(const ImmersedBoundaryObject &ibObj, co
         const Vector2D &vp = ibObj.velocity(xp);
         Scalar r = c.radius();
 
-        for (const FaceGroup &p: grid.patches())
-            for (const Face &f: p.itemsCoveredBy(Circle(xp, r + range_wall_)))
-            {
-                if(!grid.localCells().isInSet(f.lCell()))
-                    continue;
-
-                const Vector2D &xq = f.centroid();
-                Scalar d = (xp - xq).mag();
-                Vector2D norm_d = (xp - xq) / d;
-                fc += k_particle_ * std::pow(r + range_particle_ - d, 3/2) * norm_d + eta_particle_ * (vp);
-            }
+        for (const BoundaryFaceIndex::WallSegment &seg: walls.segmentsWithin(Circle(xp, r + range_wall_)))
+        {
+            const Vector2D xq = seg.nearestPoint(xp);
+            Scalar d = (xp - xq).mag();
+            Vector2D norm_d = (xp - xq) / d;
+            fc += k_particle_ * std::pow(r + range_particle_ - d, 3/2) * norm_d + eta_particle_ * (vp);
+        }
         break;
     }
     default:
@@ -1,6 +1,8 @@
 #ifndef PHASE_SOFT_SPHERE_COLLISION_MODEL_H
 #define PHASE_OFT_SPHERE_COLLISION_MODEL_H
 
+#include "FiniteVolumeGrid2D/Face/BoundaryFaceIndex.h"
+
 #include "ImmersedBoundaryObject.h"
 
 class SoftSphereCollisionModel
@@ -11,7 +13,7 @@ public:
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObjP, const ImmersedBoundaryObject& ibObjQ) const;
 
-    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
+    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const BoundaryFaceIndex& walls) const;
 
     Scalar k() const
     { return k_particle_; }
@@ -22,6 +24,9 @@ public:
     Scalar range() const
     { return range_particle_; }
 
+    Scalar kWall() const
+    { return k_wall_; }
+
 private:
 
     Scalar k_particle_, eta_particle_, range_particle_, k_wall_, eta_wall_, range_wall_;
@@ -47,6 +47,13 @@ public:
     Scalar theta() const
     { return theta_; }
 
+    //- Clock of prescribed motions, restored from checkpoints
+    virtual Scalar time() const
+    { return 0.; }
+
+    virtual void setTime(Scalar time)
+    {}
+
 protected:
 
     Scalar alpha_, omega_, theta_;
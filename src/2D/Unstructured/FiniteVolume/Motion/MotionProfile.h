@@ -18,6 +18,12 @@ public:
 
     void addMotion(Scalar startTime, const std::shared_ptr<Motion> &motion);
 
+    virtual Scalar time() const override
+    { return time_; }
+
+    virtual void setTime(Scalar time) override
+    { time_ = time; }
+
 protected:
 
     struct TimePoint
@@ -15,6 +15,12 @@ public:
 
     void update(Scalar timeStep);
 
+    Scalar time() const override
+    { return time_; }
+
+    void setTime(Scalar time) override
+    { time_ = time; }
+
 private:
 
     Point2D pos0_;
@@ -47,6 +47,23 @@ void SolidBodyMotion::update(Scalar timeStep)
 //    theta_ = std::fmod(theta_ + timeStep / 2. * (omega_ + omega0), 2. * M_PI);
 }
 
+void SolidBodyMotion::updatePosition(Scalar timeStep)
+{
+    pos_ += timeStep * vel_ + timeStep * timeStep / 2. * acc_;
+}
+
+void SolidBodyMotion::updateVelocity(Scalar timeStep, const Vector2D &force)
+{
+    auto ibObj = ibObj_.lock();
+
+    Vector2D acc0 = acc_;
+
+    force_ = constrainMotion_ ? dot(force, motionAxis_) * motionAxis_ : force;
+
+    acc_ = force_ / ibObj->mass();
+    vel_ += timeStep * (acc_ + acc0) / 2.;
+}
+
 void SolidBodyMotion::setMotionConstraint(const Vector2D &axis)
 {
     constrainMotion_ = true;
@@ -16,6 +16,11 @@ public:
 
     void update(Scalar timeStep);
 
+    //- Velocity-Verlet stages, used for sub-stepping with an externally supplied force
+    void updatePosition(Scalar timeStep);
+
+    void updateVelocity(Scalar timeStep, const Vector2D &force);
+
     void setMotionConstraint(const Vector2D &axis);
 
 private:
@@ -18,7 +18,7 @@ void Celeste::computeFaceInterfaceForces(const ScalarFiniteVolumeField &gamma, c
     auto &fst = *fst_;
     auto &kappa = *kappa_;
 
-    for (const Face &face: fst.grid()->faces())
+    for (const Face &face: activeFaces())
         fst(face) = sigma_ * kappa(face) * gradGamma(face);
 }
 
@@ -31,9 +31,10 @@ void Celeste::computeInterfaceForces(const ScalarFiniteVolumeField &gamma, const
     auto &fst = *fst_;
     auto &kappa = *kappa_;
 
-    fst.fill(Vector2D(0., 0.));
+    if(!narrowBand_)
+        fst.fill(Vector2D(0., 0.));
 
-    for (const Cell &cell: fst.cells())
+    for (const Cell &cell: activeCells(fst.cells()))
         fst(cell) = sigma_ * kappa(cell) * gradGamma(cell);
 }
 
@@ -41,14 +42,21 @@ void Celeste::computeInterfaceForces(const ScalarFiniteVolumeField &gamma, const
 
 void Celeste::computeGradGammaTilde(const ScalarFiniteVolumeField &gamma)
 {
+    updateBand(gamma);
     smoothGammaField(gamma);
 
     auto &gammaTilde = *gammaTilde_;
     auto &gradGammaTilde = *gradGammaTilde_;
 
-    gradGammaTilde.fill(Vector2D(0., 0.));
-    for (const Cell &cell: *fluid_)
-        gradGammaTilde(cell) = gradGammaTildeStencils_[cell.id()].grad(gammaTilde);
+    //- Cells leaving the band were already zeroed
+    if(!narrowBand_)
+        gradGammaTilde.fill(Vector2D(0., 0.));
+
+    for (const Cell &cell: activeCells(*fluid_))
+    {
+        gradGammaTildeStencils_.add(cell);
+        gradGammaTilde(cell) = gradGammaTildeStencils_.grad(cell, gammaTilde);
+    }
 
     gradGammaTilde.sendMessages();
 }
@@ -74,16 +82,22 @@ void Celeste::computeCurvature()
         return true;
     };
 
-    for (const Cell &cell: kappa.cells())
+    for (const Cell &cell: activeCells(kappa.cells()))
         if (validCurvature(cell))
-            kappa(cell) = kappaStencils_[cell.id()].kappa(n);
+        {
+            kappaStencils_.add(cell);
+            kappa(cell) = kappaStencils_.kappa(cell, n);
+        }
         else
             kappa(cell) = 0.;
 
     kappa.sendMessages();
 
-    for (const Face &face: kappa.grid()->interiorFaces())
+    for (const Face &face: activeFaces())
     {
+        if(face.isBoundary())
+            continue;
+
         //- According to Afkhami 2007
 
         if(n(face.lCell()).magSqr() != 0. && n(face.rCell()).magSqr() != 0.)
@@ -99,20 +113,14 @@ void Celeste::computeCurvature()
             kappa(face) = 0.;
     }
 
-    for(const Face &face: kappa.grid()->boundaryFaces())
-        if(n(face.lCell()).magSqr() != 0.)
+    for(const Face &face: activeFaces())
+        if(face.isBoundary() && n(face.lCell()).magSqr() != 0.)
             kappa(face) = kappa(face.lCell());
 }
 
 void Celeste::computeStencils()
 {
-    kappaStencils_.resize(kappa_->grid()->cells().size());
-
-    for (const Cell &cell: kappa_->grid()->cells())
-        kappaStencils_[cell.id()] = Stencil(cell, false);
-
-    gradGammaTildeStencils_.resize(gradGammaTilde_->grid()->cells().size());
-
-    for (const Cell &cell: gradGammaTilde_->grid()->cells())
-        gradGammaTildeStencils_[cell.id()] = Stencil(cell, true);
+    //- Stencils are built lazily as cells enter the interface region
+    kappaStencils_.init(*kappa_->grid(), false);
+    gradGammaTildeStencils_.init(*gradGammaTilde_->grid(), true);
 }
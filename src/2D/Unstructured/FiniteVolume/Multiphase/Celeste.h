@@ -20,48 +20,52 @@ public:
 
 protected:
 
-    class Stencil
+    //- Packed least-squares stencils, built on first use. Only the gradient rows of the pseudo-inverse are kept,
+    //  with the distance weighting folded in, stored contiguously per cell
+    class StencilStore
     {
     public:
 
-        Stencil()
+        StencilStore()
         {}
 
-        Stencil(const Cell& cell, bool weighted = false);
+        void init(const FiniteVolumeGrid2D &grid, bool weighted = false);
 
-        void init(bool weighted = false);
-
-        void reset();
-
-        const Cell& cell() const
-        { return *cellPtr_; }
+        void clear();
 
         bool weighted() const
         { return weighted_; }
 
-        virtual Vector2D grad(const ScalarFiniteVolumeField& phi) const;
+        bool contains(const Cell &cell) const
+        { return rowIds_[cell.id()] >= 0; }
 
-        virtual Scalar div(const VectorFiniteVolumeField& u) const;
+        //- Builds the stencil of a cell, does nothing if it already exists
+        void add(const Cell &cell);
 
-        virtual Scalar axiDiv(const VectorFiniteVolumeField &u) const;
+        Size size() const
+        { return cellPtr_.size() - 1; }
 
-        virtual Scalar kappa(const VectorFiniteVolumeField& n) const;
+        Vector2D grad(const Cell &cell, const ScalarFiniteVolumeField& phi) const;
 
-    protected:
+        Scalar div(const Cell &cell, const VectorFiniteVolumeField& u) const;
 
-        virtual void initMatrix();
+        Scalar axiDiv(const Cell &cell, const VectorFiniteVolumeField &u) const;
 
-        static Matrix b_;
+        Scalar kappa(const Cell &cell, const VectorFiniteVolumeField& n) const
+        { return div(cell, n); }
+
+    protected:
 
-        const Cell* cellPtr_ = nullptr;
+        const FiniteVolumeGrid2D *grid_ = nullptr;
 
-        bool weighted_;
+        bool weighted_ = false;
 
-        Matrix pInv_;
+        std::vector<Index> rowIds_;
 
-        std::vector<Ref<const Cell>> cells_;
+        //- Row i holds cells [cellPtr_[i], facePtr_[i]) and faces [facePtr_[i], cellPtr_[i + 1])
+        std::vector<Label> cellPtr_, facePtr_, ids_;
 
-        std::vector<Ref<const Face>> faces_;
+        std::vector<Vector2D> coeffs_;
     };
 
     void computeGradGammaTilde(const ScalarFiniteVolumeField &gamma);
@@ -70,7 +74,7 @@ protected:
 
     virtual void computeStencils();
 
-    std::vector<Stencil> kappaStencils_, gradGammaTildeStencils_;
+    StencilStore kappaStencils_, gradGammaTildeStencils_;
 };
 
 #endif
@@ -31,17 +31,23 @@ void CelesteAxisymmetricImmersedBoundary::computeCurvature()
         return true;
     };
 
-    for (const Cell &cell: kappa.cells())
+    for (const Cell &cell: activeCells(kappa.cells()))
         if (validCurvature(cell))
-            kappa(cell) = kappaStencils_[cell.id()].axiDiv(n);
+        {
+            kappaStencils_.add(cell);
+            kappa(cell) = kappaStencils_.axiDiv(cell, n);
+        }
         else
             kappa(cell) = 0.;
 
     kappa.sendMessages();
 
     auto ib = ib_.lock();
-    for (const Face &face: kappa.grid()->interiorFaces())
-    {   
+    for (const Face &face: activeFaces())
+    {
+        if(face.isBoundary())
+            continue;
+
         //- According to Afkhami 2007
         if(kappa(face.lCell()) != 0. && kappa(face.rCell()) != 0.)
         {
@@ -56,7 +62,7 @@ void CelesteAxisymmetricImmersedBoundary::computeCurvature()
             kappa(face) = 0.;
     }
 
-    for(const Face &face: kappa.grid()->boundaryFaces())
-        if(kappa(face.lCell()) != 0.)
+    for(const Face &face: activeFaces())
+        if(face.isBoundary() && kappa(face.lCell()) != 0.)
             kappa(face) = kappa(face.lCell());
 }
@@ -14,22 +14,15 @@ CelesteImmersedBoundary::CelesteImmersedBoundary(const Input &input,
       ib_(ib)
 {
     for(const auto& ibObj: *ib_.lock())
-    {
-        ibContactAngles_[ibObj->name()] = input.boundaryInput().get<Scalar>(
-                    "ImmersedBoundaries." + ibObj->name() + ".gamma.contactAngle",
-                    90.) * M_PI / 180.;
-    }
-
-    auto ibInput = input.boundaryInput().get_child_optional("ImmersedBoundaryGeometryFile");
-
-    if(ibInput)
-    {
-        std::string filename = ibInput.get().get<std::string>("filename");
-        Scalar theta = ibInput.get().get<Scalar>("fields.gamma.contactAngle", 90.) * M_PI / 180.;
-
-        for(const auto &ibObjInput: input.read(filename))
-            ibContactAngles_[ibObjInput.first] =  theta;
-    }
+        if(input.boundaryInput().get_child_optional("ImmersedBoundaries." + ibObj->name()))
+            ibContactAngles_[ibObj->name()] = input.boundaryInput().get<Scalar>(
+                        "ImmersedBoundaries." + ibObj->name() + ".gamma.contactAngle",
+                        90.) * M_PI / 180.;
+
+    //- Geometry file objects share one contact angle, distributed ones may only be created after construction
+    defaultContactAngle_ = input.boundaryInput().get<Scalar>(
+                "ImmersedBoundaryGeometryFile.fields.gamma.contactAngle",
+                90.) * M_PI / 180.;
 }
 
 void CelesteImmersedBoundary::computeFaceInterfaceForces(const ScalarFiniteVolumeField &gamma, const ScalarGradient &gradGamma)
@@ -40,7 +33,7 @@ void CelesteImmersedBoundary::computeFaceInterfaceForces(const ScalarFiniteVolum
 Scalar CelesteImmersedBoundary::theta(const ImmersedBoundaryObject &ibObj) const
 {
     auto it = ibContactAngles_.find(ibObj.name());
-    return it != ibContactAngles_.end() ? it->second : M_PI_2;
+    return it != ibContactAngles_.end() ? it->second : defaultContactAngle_;
 }
 
 void CelesteImmersedBoundary::computeContactLineExtension(ScalarFiniteVolumeField &gamma) const
@@ -53,10 +46,7 @@ void CelesteImmersedBoundary::computeContactLineExtension(ScalarFiniteVolumeFiel
 
                 if(distSqr <= kernelWidth_ * kernelWidth_)
                 {
-                    ContactLineStencil st(*ibObj,
-                                          cell.centroid(),
-                                          ibContactAngles_.find(ibObj->name())->second,
-                                          gamma);
+                    const ContactLineStencil &st = contactLineStencil(*ibObj, cell, gamma);
 
                     if(st.isValid())
                         gamma(cell) = st.gamma();
@@ -74,6 +64,57 @@ CelesteImmersedBoundary::ContactLineStencil CelesteImmersedBoundary::contactLine
     return ContactLineStencil(*ibObj, xc, theta(*ibObj), gamma);
 }
 
+const CelesteImmersedBoundary::ContactLineStencil &CelesteImmersedBoundary::contactLineStencil(const ImmersedBoundaryObject &ibObj,
+                                                                                                 const Cell &cell,
+                                                                                                 const ScalarFiniteVolumeField &gamma,
+                                                                                                 bool onBoundary) const
+{
+    if(ib_.lock()->syncNo() != contactLineStencilCacheSyncNo_)
+        pruneContactLineStencilCache();
+
+    auto insert = contactLineStencilCache_.emplace(ibObj.id(), ContactLineStencilCache());
+    ContactLineStencilCache &cache = insert.first->second;
+
+    //- A distributed ghost may be dropped and received again as a new object with the same id
+    if(insert.second || cache.ibObj != &ibObj || !(cache.position == ibObj.position()) || cache.theta != ibObj.theta())
+    {
+        cache.ibObj = &ibObj;
+        cache.position = ibObj.position();
+        cache.theta = ibObj.theta();
+        cache.cellStencils.clear();
+        cache.boundaryStencils.clear();
+    }
+
+    auto &stencils = onBoundary ? cache.boundaryStencils : cache.cellStencils;
+    auto it = stencils.find(cell.id());
+
+    if(it == stencils.end())
+        it = stencils.emplace(cell.id(), ContactLineStencil(ibObj,
+                                                            onBoundary ? ibObj.nearestIntersect(cell.centroid()) : cell.centroid(),
+                                                            theta(ibObj))).first;
+
+    it->second.update(gamma);
+
+    return it->second;
+}
+
+void CelesteImmersedBoundary::pruneContactLineStencilCache() const
+{
+    auto ib = ib_.lock();
+    std::unordered_set<Label> ids;
+
+    for(const auto &ibObj: *ib)
+        ids.insert(ibObj->id());
+
+    for(auto it = contactLineStencilCache_.begin(); it != contactLineStencilCache_.end();)
+        if(ids.find(it->first) == ids.end())
+            it = contactLineStencilCache_.erase(it);
+        else
+            ++it;
+
+    contactLineStencilCacheSyncNo_ = ib->syncNo();
+}
+
 void CelesteImmersedBoundary::computeContactLineStencils(const ScalarFiniteVolumeField &gamma)
 {
     contactLineExtensionCells_.clear();
@@ -87,10 +128,7 @@ void CelesteImmersedBoundary::computeContactLineStencils(const ScalarFiniteVolum
 
                 if(distSqr <= kernelWidth_ * kernelWidth_)
                 {
-                    contactLineStencils_.emplace_back(*ibObj,
-                                                      cell.centroid(),
-                                                      ibContactAngles_.find(ibObj->name())->second,
-                                                      gamma);
+                    contactLineStencils_.push_back(contactLineStencil(*ibObj, cell, gamma));
 
                     contactLineExtensionCells_.add(cell);
                 }
@@ -105,6 +143,9 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
                                                const Vector2D &g,
                                                DirectForcingImmersedBoundary &ib) const
 {
+    if(ib.isDistributed())
+        throw Exception("CelesteImmersedBoundary", "applyFluidForces", "not supported for distributed immersed boundaries.");
+
     struct Stress
     {
         Point2D pt;
@@ -169,10 +210,7 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
             auto tau = Tensor2D(derivs(0, 0), derivs(1, 0), derivs(0, 1), derivs(1, 1));
 
 
-            auto clst = ContactLineStencil(*ibObj,
-                                           xb,
-                                           theta(*ibObj),
-                                           gamma);
+            const ContactLineStencil &clst = contactLineStencil(*ibObj, cell, gamma, true);
 
             Scalar mub = clst.interpolate(mu);
 
@@ -367,29 +405,36 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
         Vector2D tcl;
     };
 
-    std::vector<Stress> stresses;
+    std::vector<std::vector<Stress>> allStresses(ib.ibObjs().size());
+    std::vector<Vector2D> allFh(ib.ibObjs().size(), Vector2D(0., 0.));
 
-    for(auto &ibObj: ib)
+    for(Label i = 0; i < ib.ibObjs().size(); ++i)
     {
-        Vector2D fh(0., 0.);
+        const auto &ibObj = ib.ibObjs()[i];
 
         for(const Cell &c: ibObj->cells())
-            fh -= fb(c) * c.volume();
+            allFh[i] -= fb(c) * c.volume();
 
-        fh = grid_->comm().sum(fh);
-
-        stresses.clear();
-        stresses.reserve(ibObj->ibCells().size());
+        allStresses[i].reserve(ibObj->ibCells().size());
 
         for(const Cell &c: ibObj->ibCells())
         {
             Point2D bp = ibObj->nearestIntersect(c.centroid());
             Scalar th = (bp - ibObj->shape().centroid()).angle();
-            auto cl = ContactLineStencil(*ibObj, bp, theta(*ibObj), gamma);
-            stresses.push_back(Stress{bp, th, cl.interpolate(rho), cl.gamma(), cl.tcl()});
+            const ContactLineStencil &cl = contactLineStencil(*ibObj, c, gamma, true);
+            allStresses[i].push_back(Stress{bp, th, cl.interpolate(rho), cl.gamma(), cl.tcl()});
         }
+    }
+
+    //- Communicate all objects at once
+    allFh = ib.sum(allFh);
+    allStresses = ib.gather(allStresses);
 
-        stresses = grid_->comm().allGatherv(stresses);
+    for(Label i = 0; i < ib.ibObjs().size(); ++i)
+    {
+        const auto &ibObj = ib.ibObjs()[i];
+        const Vector2D &fh = allFh[i];
+        auto &stresses = allStresses[i];
 
         std::sort(stresses.begin(), stresses.end(), [&ibObj](const Stress &lhs, const Stress &rhs)
         { return lhs.th < rhs.th; });
@@ -444,7 +489,7 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
 
         Vector2D fw = ibObj->rho * ibObj->shape().area() * g;
 
-        if(grid_->comm().isMainProc())
+        if(grid_->comm().isMainProc() && ibObj->isReplicated())
         {
             std::cout << "Hydrodynamic force = " << fh << "\n"
                       << "Buoyancy force = " << fb << "\n"
@@ -462,8 +507,16 @@ void CelesteImmersedBoundary::computeInterfaceNormals()
     const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
     VectorFiniteVolumeField &n = *n_;
 
-    for (const Cell &cell: n.grid()->cells())
-        n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
+    auto normal = [this, &gradGammaTilde](const Cell &cell)
+    { return gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.); };
+
+    //- Without a band, solid cells are cleared as well
+    if(narrowBand_)
+        for (const Cell &cell: activeCells(*fluid_))
+            n(cell) = normal(cell);
+    else
+        for (const Cell &cell: n.grid()->cells())
+            n(cell) = normal(cell);
 
     //- Override the ib cells in the contact line region only
     for(const auto &ibObj: *ib_.lock())
@@ -474,12 +527,7 @@ void CelesteImmersedBoundary::computeInterfaceNormals()
 
                 if(distSqr <= kernelWidth_ * kernelWidth_)
                 {
-                    ContactLineStencil st(*ibObj,
-                                          cell.centroid(),
-                                          ibContactAngles_.find(ibObj->name())->second,
-                                          *gammaTilde_);
-
-                    n(cell) = st.ncl();
+                    n(cell) = contactLineStencil(*ibObj, cell, *gammaTilde_).ncl();
                 }
             }
 
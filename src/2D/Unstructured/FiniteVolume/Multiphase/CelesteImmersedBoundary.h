@@ -14,12 +14,18 @@ public:
     {
     public:
 
+        //- Geometry only, the stencil must be updated before it is evaluated
+        ContactLineStencil(const ImmersedBoundaryObject &ibObj,
+                           const Point2D &pt,
+                           Scalar theta);
+
         ContactLineStencil(const ImmersedBoundaryObject &ibObj,
                            const Point2D &pt,
                            Scalar theta,
                            const ScalarFiniteVolumeField &gamma);
 
-        void init();
+        //- Selects the stencil cells and evaluates gamma and the contact line normal, no geometric searches are repeated
+        void update(const ScalarFiniteVolumeField &gamma);
 
         bool isValid() const
         { return ibObj_ && ((cellA_ && cellB_) || (cellA_ && face_)); }
@@ -57,15 +63,32 @@ public:
 
     protected:
 
+        //- Interpolation stencil found along one search ray
+        struct RayStencil
+        {
+            const Cell *cellA, *cellB;
+
+            const Face *face;
+
+            Scalar alpha;
+
+            StaticPolyLine2D<3> cl;
+
+            bool isValid() const
+            { return (cellA && cellB) || (cellA && face); }
+        };
+
         static std::queue<Ref<const Cell>> cellQueue_;
 
         static std::unordered_set<Label> cellIdSet_;
 
-        void init(const ScalarFiniteVolumeField &gamma);
+        void initNormal(const ScalarFiniteVolumeField &gamma);
+
+        const RayStencil &normalStencil();
 
-        void init(const Ray2D &r1, const Ray2D &r2, const ScalarFiniteVolumeField &gamma);
+        RayStencil findStencilCells(const Ray2D &r) const;
 
-        void findStencilCells(const Ray2D &r);
+        void select(const RayStencil &st);
 
         const ImmersedBoundaryObject *ibObj_;
 
@@ -78,6 +101,11 @@ public:
         StaticPolyLine2D<3> cl_;
 
         Vector2D ns_, ncl_;
+
+        //- Candidate stencils along the two contact angle rays and the surface normal
+        RayStencil st1_, st2_, stn_;
+
+        bool hasNormalStencil_;
     };
 
     CelesteImmersedBoundary(const Input &input,
@@ -93,6 +121,12 @@ public:
 
     ContactLineStencil contactLineStencil(const Point2D &xc, const ScalarFiniteVolumeField &gamma) const;
 
+    //- Cached stencils from a cell centroid or from its nearest point on the object, evaluated with gamma
+    const ContactLineStencil &contactLineStencil(const ImmersedBoundaryObject &ibObj,
+                                                 const Cell &cell,
+                                                 const ScalarFiniteVolumeField &gamma,
+                                                 bool onBoundary = false) const;
+
     void computeContactLineStencils(const ScalarFiniteVolumeField &gamma);
 
     void applyFluidForces(const ScalarFiniteVolumeField &rho,
@@ -117,9 +151,32 @@ protected:
 
     std::unordered_map<std::string, Scalar> ibContactAngles_;
 
+    //- Contact angle of objects without their own entry, eg those read from a geometry file
+    Scalar defaultContactAngle_;
+
     CellGroup contactLineExtensionCells_;
 
     std::vector<ContactLineStencil> contactLineStencils_;
+
+    //- Stencil geometry does not depend on gamma, so the stencils of an object are only rebuilt when it moves
+    struct ContactLineStencilCache
+    {
+        const ImmersedBoundaryObject *ibObj;
+
+        Point2D position;
+
+        Scalar theta;
+
+        std::unordered_map<Label, ContactLineStencil> cellStencils, boundaryStencils;
+    };
+
+    //- Drops the stencils of objects this process no longer holds
+    void pruneContactLineStencilCache() const;
+
+    //- Keyed by object id, pruned whenever distributed objects have been exchanged
+    mutable std::unordered_map<Label, ContactLineStencilCache> contactLineStencilCache_;
+
+    mutable Size contactLineStencilCacheSyncNo_ = 0;
 };
 
 #endif
@@ -8,27 +8,86 @@ std::unordered_set<Label> CelesteImmersedBoundary::ContactLineStencil::cellIdSet
 
 CelesteImmersedBoundary::ContactLineStencil::ContactLineStencil(const ImmersedBoundaryObject &ibObj,
                                                                 const Point2D &pt,
-                                                                Scalar theta,
-                                                                const ScalarFiniteVolumeField &gamma)
+                                                                Scalar theta)
     :
       ibObj_(&ibObj),
       cellA_(nullptr),
       cellB_(nullptr),
       face_(nullptr),
-      theta_(theta)
+      theta_(theta),
+      alpha_(0.),
+      gamma_(0.),
+      hasNormalStencil_(false)
 {
     cl_[0] = pt;
     ns_ = -ibObj_->nearestEdgeUnitNormal(cl_[0]);
 
     if(theta_ == M_PI_2)
-        init(gamma);
+        return;
+
+    //- Rays that miss fall back to the normal stencil
+    st1_ = findStencilCells(Ray2D(cl_[0], ns_.rotate(M_PI_2 - theta_)));
+
+    if(!st1_.isValid())
+        st1_ = normalStencil();
+
+    st2_ = findStencilCells(Ray2D(cl_[0], ns_.rotate(theta_ - M_PI_2)));
+
+    if(!st2_.isValid())
+        st2_ = normalStencil();
+}
+
+CelesteImmersedBoundary::ContactLineStencil::ContactLineStencil(const ImmersedBoundaryObject &ibObj,
+                                                                const Point2D &pt,
+                                                                Scalar theta,
+                                                                const ScalarFiniteVolumeField &gamma)
+    :
+      ContactLineStencil(ibObj, pt, theta)
+{
+    update(gamma);
+}
+
+void CelesteImmersedBoundary::ContactLineStencil::update(const ScalarFiniteVolumeField &gamma)
+{
+    if(theta_ == M_PI_2)
+    {
+        initNormal(gamma);
+        return;
+    }
+
+    if(st1_.isValid() && st2_.isValid())
+    {
+        select(st1_);
+        Scalar g1 = interpolate(gamma);
+
+        select(st2_);
+        Scalar g2 = interpolate(gamma);
+
+        if(g1 == g2)
+            initNormal(gamma);
+        else if((theta_ < M_PI_2 && g1 > g2) || (theta_ > M_PI_2 && g1 < g2))
+        {
+            select(st1_);
+            gamma_ = g1;
+            ncl_ = ns_.rotate(-theta_);
+        }
+        else
+        {
+            gamma_ = g2;
+            ncl_ = ns_.rotate(theta_);
+        }
+    }
     else
-        init(Ray2D(cl_[0], ns_.rotate(M_PI_2 - theta_)), Ray2D(cl_[0], ns_.rotate(theta_ - M_PI_2)), gamma);
+    {
+        std::cout << "Warning, failed to find valid contact line stencil on proc " << gamma.grid()->comm().rank()
+                  << ". Initiating normal stencil stencil...\n";
+        initNormal(gamma);
+    }
 }
 
-void CelesteImmersedBoundary::ContactLineStencil::init(const ScalarFiniteVolumeField &gamma)
+void CelesteImmersedBoundary::ContactLineStencil::initNormal(const ScalarFiniteVolumeField &gamma)
 {
-    findStencilCells(Ray2D(cl_[0], ns_));
+    select(normalStencil());
 
     if(!isValid())
     {
@@ -39,7 +98,7 @@ void CelesteImmersedBoundary::ContactLineStencil::init(const ScalarFiniteVolumeF
            << "Cells searched = " << cellIdSet_.size() << ".";
 
         throw Exception("CelesteImmersedBoundary::ContactLineStencil",
-                        "init",
+                        "initNormal",
                         os.str());
     }
 
@@ -58,56 +117,32 @@ void CelesteImmersedBoundary::ContactLineStencil::init(const ScalarFiniteVolumeF
         ncl_ = ns_.rotate(M_PI_2);
 }
 
-void CelesteImmersedBoundary::ContactLineStencil::init(const Ray2D &r1, const Ray2D &r2, const ScalarFiniteVolumeField &gamma)
+const CelesteImmersedBoundary::ContactLineStencil::RayStencil &CelesteImmersedBoundary::ContactLineStencil::normalStencil()
 {
-    findStencilCells(r1);
-    ContactLineStencil c1 = *this;
-
-    if(!c1.isValid())
+    if(!hasNormalStencil_)
     {
-        findStencilCells(Ray2D(cl_[0], ns_));
-        c1 = *this;
+        stn_ = findStencilCells(Ray2D(cl_[0], ns_));
+        hasNormalStencil_ = true;
     }
 
-    findStencilCells(r2);
-    ContactLineStencil c2 = *this;
-
-    if(!c2.isValid())
-    {
-        findStencilCells(Ray2D(cl_[0], ns_));
-        c2 = *this;
-    }
+    return stn_;
+}
 
-    if(c1.isValid() && c2.isValid())
-    {
-        Scalar g1 = c1.interpolate(gamma);
-        Scalar g2 = c2.interpolate(gamma);
+void CelesteImmersedBoundary::ContactLineStencil::select(const RayStencil &st)
+{
+    cellA_ = st.cellA;
+    cellB_ = st.cellB;
+    face_ = st.face;
+    alpha_ = st.alpha;
 
-        if(g1 == g2)
-            init(gamma);
-        else if((theta_ < M_PI_2 && g1 > g2) || (theta_ > M_PI_2 && g1 < g2))
-        {
-            *this = c1;
-            gamma_ = g1;
-            ncl_ = ns_.rotate(-theta_);
-        }
-        else
-        {
-            *this = c2;
-            gamma_ = g2;
-            ncl_ = ns_.rotate(theta_);
-        }
-    }
-    else
-    {
-        std::cout << "Warning, failed to find valid contact line stencil on proc " << gamma.grid()->comm().rank()
-                  << ". Initiating normal stencil stencil...\n";
-        init(gamma);
-    }
+    if(st.isValid())
+        cl_ = st.cl;
 }
 
-void CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &r)
+CelesteImmersedBoundary::ContactLineStencil::RayStencil CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &r) const
 {
+    RayStencil st{nullptr, nullptr, nullptr, 0., cl_};
+
     auto intersections = ibObj_->shape().intersections(r);
 
     if(intersections.empty())
@@ -121,10 +156,6 @@ void CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &
     Scalar minDistSqr = std::numeric_limits<Scalar>::max();
     bool foundIntersection = false;
 
-    cellA_ = nullptr;
-    cellB_ = nullptr;
-    face_ = nullptr;
-
     Vector2D bp = intersections.front();
     cellQueue_.emplace(ibObj_->cells().nearestItem(bp));
     cellIdSet_.clear();
@@ -160,11 +191,11 @@ void CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &
                     foundIntersection = true;
                     minDistSqr = distSqr;
 
-                    cellA_ = &nb.self();
-                    cellB_ = &nb.cell();
-                    face_ = nullptr;
+                    st.cellA = &nb.self();
+                    st.cellB = &nb.cell();
+                    st.face = nullptr;
 
-                    cl_ = {
+                    st.cl = {
                         r.x0(),
                         bp,
                         xc.first
@@ -190,11 +221,11 @@ void CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &
                     foundIntersection = true;
                     minDistSqr = distSqr;
 
-                    cellA_ = &bd.self();
-                    cellB_ = nullptr;
-                    face_ = &bd.face();
+                    st.cellA = &bd.self();
+                    st.cellB = nullptr;
+                    st.face = &bd.face();
 
-                    cl_ = {
+                    st.cl = {
                         r.x0(),
                         bp,
                         xc.first
@@ -209,17 +240,19 @@ void CelesteImmersedBoundary::ContactLineStencil::findStencilCells(const Ray2D &
 
     if(foundIntersection)
     {
-        if(cellA_ && cellB_)
+        if(st.cellA && st.cellB)
         {
-            Scalar l1 = (cl_[2] - cellA_->centroid()).mag();
-            Scalar l2 = (cl_[2] - cellB_->centroid()).mag();
-            alpha_ = l2 / (l1 + l2);
+            Scalar l1 = (st.cl[2] - st.cellA->centroid()).mag();
+            Scalar l2 = (st.cl[2] - st.cellB->centroid()).mag();
+            st.alpha = l2 / (l1 + l2);
         }
-        else if(cellA_ && face_)
+        else if(st.cellA && st.face)
         {
-            Scalar l1 = (cl_[2] - cellA_->centroid()).mag();
-            Scalar l2 = (cl_[2] - face_->centroid()).mag();
-            alpha_ = l2 / (l1 + l2);
+            Scalar l1 = (st.cl[2] - st.cellA->centroid()).mag();
+            Scalar l2 = (st.cl[2] - st.face->centroid()).mag();
+            st.alpha = l2 / (l1 + l2);
         }
     }
+
+    return st;
 }
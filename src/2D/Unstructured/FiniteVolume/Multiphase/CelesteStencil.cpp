@@ -1,164 +1,140 @@
 #include "Celeste.h"
 
-Matrix Celeste::Stencil::b_;
+void Celeste::StencilStore::init(const FiniteVolumeGrid2D &grid, bool weighted)
+{
+    grid_ = &grid;
+    weighted_ = weighted;
+    clear();
+}
 
-Celeste::Stencil::Stencil(const Cell &cell, bool weighted)
-    :
-      cellPtr_(&cell)
+void Celeste::StencilStore::clear()
 {
-    init(weighted);
+    rowIds_.assign(grid_ ? grid_->cells().size() : 0, -1);
+    cellPtr_.assign(1, 0);
+    facePtr_.clear();
+    ids_.clear();
+    coeffs_.clear();
 }
 
-void Celeste::Stencil::init(bool weighted)
+void Celeste::StencilStore::add(const Cell &cell)
 {
-    weighted_ = weighted;
-    const Cell &cell = *cellPtr_;
+    if(contains(cell))
+        return;
 
-    reset();
+    std::vector<Ref<const Cell>> cells;
+    std::vector<Ref<const Face>> faces;
 
     for (const InteriorLink &nb: cell.neighbours())
     {
-        cells_.push_back(std::cref(nb.cell()));
+        cells.push_back(std::cref(nb.cell()));
 
         if (!cell.boundaries().empty())
             for (const BoundaryLink &bd: nb.cell().boundaries())
-                faces_.push_back(std::cref(bd.face()));
+                faces.push_back(std::cref(bd.face()));
     }
 
     for (const CellLink &dg: cell.diagonals())
-        cells_.push_back(std::cref(dg.cell()));
+        cells.push_back(std::cref(dg.cell()));
 
     for (const BoundaryLink &bd: cell.boundaries())
-        faces_.push_back(std::cref(bd.face()));
+        faces.push_back(std::cref(bd.face()));
 
-    initMatrix();
-}
-
-void Celeste::Stencil::reset()
-{
-    cells_.clear();
-    faces_.clear();
-}
+    //- Least-squares fit of a quadratic about the cell centroid
+    Matrix A(cells.size() + faces.size(), 5);
+    std::vector<Scalar> s;
+    s.reserve(A.m());
 
-Vector2D Celeste::Stencil::grad(const ScalarFiniteVolumeField &phi) const
-{
-    b_.resize(pInv_.n(), 1);
-    int i = 0;
-
-    const Cell &cell = *cellPtr_;
-
-    for (const Cell &kCell: cells_)
+    auto addRow = [this, &A, &s, &cell](const Point2D &pt)
     {
-        Scalar s = weighted_ ? (kCell.centroid() - cell.centroid()).magSqr() : 1.;
-        b_(i++, 0) = (phi(kCell) - phi(cell)) / s;
-    }
+        Vector2D r = pt - cell.centroid();
+        s.push_back(weighted_ ? r.magSqr() : 1.);
+
+        A.setRow(s.size() - 1, {
+                     r.x * r.x / (2. * s.back()),
+                     r.y * r.y / (2. * s.back()),
+                     r.x * r.y / s.back(),
+                     r.x / s.back(),
+                     r.y / s.back()
+                 });
+    };
 
-    for (const Face &face: faces_)
-    {
-        Scalar s = weighted_ ? (face.centroid() - cell.centroid()).magSqr() : 1.;
-        b_(i++, 0) = (phi(face) - phi(cell)) / s;
-    }
+    for (const Cell &kCell: cells)
+        addRow(kCell.centroid());
 
-    b_ = pInv_ * b_;
-    return Vector2D(b_(b_.m() - 2, 0), b_(b_.m() - 1, 0));
-}
+    for (const Face &face: faces)
+        addRow(face.centroid());
 
-Scalar Celeste::Stencil::div(const VectorFiniteVolumeField &u) const
-{
-    b_.resize(pInv_.n(), 2);
+    Matrix pInv = pseudoInverse(A);
 
-    const Cell &cell = *cellPtr_;
+    rowIds_[cell.id()] = facePtr_.size();
 
-    int i = 0;
-    for (const Cell &kCell: cells_)
+    for (Label k = 0; k < cells.size(); ++k)
     {
-        Scalar s = weighted_ ? (kCell.centroid() - cell.centroid()).magSqr() : 1.;
-        Vector2D du = (u(kCell) - u(cell)) / s;
-        b_(i, 0) = du.x;
-        b_(i++, 1) = du.y;
+        ids_.push_back(cells[k].get().id());
+        coeffs_.push_back(Vector2D(pInv(3, k), pInv(4, k)) / s[k]);
     }
 
-    for (const Face &face: faces_)
+    facePtr_.push_back(ids_.size());
+
+    for (Label k = 0; k < faces.size(); ++k)
     {
-        Scalar s = weighted_ ? (face.centroid() - cell.centroid()).magSqr() : 1.;
-        Vector2D du = (u(face) - u(cell)) / s;
-        b_(i, 0) = du.x;
-        b_(i++, 1) = du.y;
+        ids_.push_back(faces[k].get().id());
+        coeffs_.push_back(Vector2D(pInv(3, cells.size() + k), pInv(4, cells.size() + k)) / s[cells.size() + k]);
     }
 
-    b_ = pInv_ * b_;
-    return b_(b_.m() - 2, 0) + b_(b_.m() - 1, 1);
+    cellPtr_.push_back(ids_.size());
 }
 
-Scalar Celeste::Stencil::axiDiv(const VectorFiniteVolumeField &u) const
+Vector2D Celeste::StencilStore::grad(const Cell &cell, const ScalarFiniteVolumeField &phi) const
 {
-    b_.resize(pInv_.n(), 2);
+    Label row = rowIds_[cell.id()];
+    Scalar phiC = phi(cell);
+    Vector2D grad(0., 0.);
 
-    const Cell &cell = *cellPtr_;
+    for (Label k = cellPtr_[row]; k < facePtr_[row]; ++k)
+        grad += coeffs_[k] * (phi(ids_[k]) - phiC);
 
-    int i = 0;
-    for (const Cell &kCell: cells_)
-    {
-        Scalar s = weighted_ ? (kCell.centroid() - cell.centroid()).magSqr() : 1.;
-        Vector2D du = (Vector2D(kCell.centroid().x * u(kCell).x, u(kCell).y)
-                       - Vector2D(cell.centroid().x * u(cell).x, u(cell).y)) / s;
-        b_(i, 0) = du.x;
-        b_(i++, 1) = du.y;
-    }
-
-    for (const Face &face: faces_)
-    {
-        Scalar s = weighted_ ? (face.centroid() - cell.centroid()).magSqr() : 1.;
-        Vector2D du = (Vector2D(face.centroid().x * u(face).x, u(face).y)
-                       - Vector2D(cell.centroid().x * u(cell).x, u(cell).y)) / s;
-        b_(i, 0) = du.x;
-        b_(i++, 1) = du.y;
-    }
+    for (Label k = facePtr_[row]; k < cellPtr_[row + 1]; ++k)
+        grad += coeffs_[k] * (phi.faces()[ids_[k]] - phiC);
 
-    b_ = pInv_ * b_;
-    return b_(b_.m() - 2, 0) / cell.centroid().x + b_(b_.m() - 1, 1);
+    return grad;
 }
 
-Scalar Celeste::Stencil::kappa(const VectorFiniteVolumeField &n) const
+Scalar Celeste::StencilStore::div(const Cell &cell, const VectorFiniteVolumeField &u) const
 {
-    return div(n);
-}
+    Label row = rowIds_[cell.id()];
+    const Vector2D &uC = u(cell);
+    Scalar div = 0.;
 
-//- Private methods
+    for (Label k = cellPtr_[row]; k < facePtr_[row]; ++k)
+        div += dot(coeffs_[k], u(ids_[k]) - uC);
 
-void Celeste::Stencil::initMatrix()
+    for (Label k = facePtr_[row]; k < cellPtr_[row + 1]; ++k)
+        div += dot(coeffs_[k], u.faces()[ids_[k]] - uC);
+
+    return div;
+}
+
+Scalar Celeste::StencilStore::axiDiv(const Cell &cell, const VectorFiniteVolumeField &u) const
 {
-    Matrix A(cells_.size() + faces_.size(), 5);
-    const Cell &cell = *cellPtr_;
+    Label row = rowIds_[cell.id()];
+    Scalar rC = cell.centroid().x;
+    Vector2D uC = Vector2D(rC * u(cell).x, u(cell).y);
+    Scalar dr = 0., dz = 0.;
 
-    int i = 0;
-    for (const Cell &kCell: cells_)
+    for (Label k = cellPtr_[row]; k < facePtr_[row]; ++k)
     {
-        Vector2D r = kCell.centroid() - cell.centroid();
-        Scalar s = weighted_ ? r.magSqr() : 1.;
-
-        A.setRow(i++, {
-                     r.x * r.x / 2. / s,
-                     r.y * r.y / 2. / s,
-                     r.x * r.y / s,
-                     r.x / s,
-                     r.y / s
-                 });
+        const Cell &kCell = grid_->cells()[ids_[k]];
+        dr += coeffs_[k].x * (kCell.centroid().x * u(kCell).x - uC.x);
+        dz += coeffs_[k].y * (u(kCell).y - uC.y);
     }
 
-    for (const Face &face: faces_)
+    for (Label k = facePtr_[row]; k < cellPtr_[row + 1]; ++k)
     {
-        Vector2D r = face.centroid() - cell.centroid();
-        Scalar s = weighted_ ? r.magSqr() : 1.;
-
-        A.setRow(i++, {
-                     r.x * r.x / (2. * s),
-                     r.y * r.y / (2. * s),
-                     r.x * r.y / s,
-                     r.x / s,
-                     r.y / s
-                 });
+        const Face &face = grid_->faces()[ids_[k]];
+        dr += coeffs_[k].x * (face.centroid().x * u(face).x - uC.x);
+        dz += coeffs_[k].y * (u(face).y - uC.y);
     }
 
-    pInv_ = pseudoInverse(A);
+    return dr / rC + dz;
 }
@@ -23,8 +23,17 @@ SurfaceTensionForce::SurfaceTensionForce(const Input &input,
     minTheta_ = input.caseInput().get<Scalar>("Solver.minContactAngle", 0.) * M_PI / 180.;
     maxTheta_ = input.caseInput().get<Scalar>("Solver.maxContactAngle", 180.) * M_PI / 180.;
 
-    for(const Cell &cell: *fluid_)
-        kernels_.push_back(SmoothingKernel(cell, kernelWidth_, kernelType_));
+    kernel_.init(*fluid_, kernelWidth_, kernelType_);
+
+    //- Restrict the surface tension computation to a band around the interface
+    narrowBand_ = input.caseInput().get<bool>("Solver.narrowBand", false);
+    nBandLayers_ = input.caseInput().get<int>("Solver.narrowBandLayers", 2);
+    bandRebuildInterval_ = input.caseInput().get<int>("Solver.narrowBandRebuildInterval", 0);
+    bandTol_ = input.caseInput().get<Scalar>("Solver.narrowBandTolerance", 1e-8);
+
+    allFaces_.assign(grid_->faces().begin(), grid_->faces().end());
+    isInBand_.assign(grid_->cells().size(), false);
+    isBandFace_.assign(grid_->faces().size(), false);
 
     //- Determine which patches contact angles will be enforced on
     for (const FaceGroup &patch: grid->patches())
@@ -39,6 +48,7 @@ void SurfaceTensionForce::setCellGroup(const std::shared_ptr<const CellGroup> &f
     gammaTilde_->setCellGroup(fluid);
     n_->setCellGroup(fluid);
     gradGammaTilde_->setCellGroup(fluid);
+    rebuildBand_ = true;
 }
 
 void SurfaceTensionForce::computeInterfaceNormals()
@@ -46,7 +56,7 @@ void SurfaceTensionForce::computeInterfaceNormals()
     const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
     VectorFiniteVolumeField &n = *n_;
 
-    for (const Cell &cell: *fluid_)
+    for (const Cell &cell: activeCells(*fluid_))
         n(cell) = gradGammaTilde(cell).magSqr() >= eps_ * eps_ ? -gradGammaTilde(cell).unitVec() : Vector2D(0., 0.);
 
     n.sendMessages();
@@ -77,8 +87,7 @@ void SurfaceTensionForce::computeInterfaceNormals()
 
 void SurfaceTensionForce::setAxisymmetric(bool axisymmetric)
 {
-    for(auto &k: kernels_)
-        k.setAxisymmetric(axisymmetric);
+    kernel_.setAxisymmetric(axisymmetric);
 }
 
 Scalar SurfaceTensionForce::theta(const FaceGroup &patch) const
@@ -97,14 +106,71 @@ void SurfaceTensionForce::smoothGammaField(const ScalarFiniteVolumeField &gamma)
 {
     auto &gammaTilde = *gammaTilde_;
 
-    gammaTilde.fill(0.);
-    for(const auto &k: kernels_)
-        gammaTilde(k.cell()) = k.eval(gamma);
+    if(narrowBand_)
+    {
+        //- Outside the band gamma is uniform and smoothing leaves it unchanged
+        for(const Cell &cell: bandCells_)
+            if(kernel_.row(cell) >= 0)
+                gammaTilde(cell) = kernel_.eval(kernel_.row(cell), gamma);
+    }
+    else
+    {
+        gammaTilde.fill(0.);
+        kernel_.eval(gamma, gammaTilde);
+    }
 
     gammaTilde.sendMessages();
     gammaTilde.setBoundaryFaces();
 }
 
+void SurfaceTensionForce::updateBand(const ScalarFiniteVolumeField &gamma)
+{
+    if(!narrowBand_)
+        return;
+
+    if(rebuildBand_ || (bandRebuildInterval_ > 0 && ++nBandUpdates_ % bandRebuildInterval_ == 0))
+    {
+        rebuildBand(gamma);
+        return;
+    }
+
+    //- The interface moves less than a cell per step, so new interface cells lie in the old band or next to it.
+    //  Buffer cells are always checked so that interfaces entering from other processes are picked up
+    std::vector<bool> isCandidate(grid_->cells().size(), false);
+    std::vector<Ref<const Cell>> candidates;
+
+    auto addCandidate = [&isCandidate, &candidates](const Cell &cell)
+    {
+        if(!isCandidate[cell.id()])
+        {
+            isCandidate[cell.id()] = true;
+            candidates.push_back(std::cref(cell));
+        }
+    };
+
+    for(const Cell &cell: bandCells_)
+    {
+        addCandidate(cell);
+
+        for(const InteriorLink &nb: cell.neighbours())
+            addCandidate(nb.cell());
+    }
+
+    for(const CellGroup &bufferCells: grid_->bufferGroups())
+        for(const Cell &cell: bufferCells)
+            addCandidate(cell);
+
+    resetBand(gamma);
+
+    interfaceCells_.clear();
+
+    for(const Cell &cell: candidates)
+        if(isInterfaceCell(gamma, cell))
+            interfaceCells_.push_back(std::cref(cell));
+
+    buildBand();
+}
+
 SurfaceTensionForce::SmoothingKernel::Type SurfaceTensionForce::getKernelType(std::string type)
 {
     std::transform(type.begin(), type.end(), type.begin(), ::tolower);
@@ -120,6 +186,121 @@ SurfaceTensionForce::SmoothingKernel::Type SurfaceTensionForce::getKernelType(st
 
 }
 
+//- Protected
+
+void SurfaceTensionForce::rebuildBand(const ScalarFiniteVolumeField &gamma)
+{
+    auto &gammaTilde = *gammaTilde_;
+
+    //- Outside the fluid gammaTilde stays zero, as with the full computation
+    gammaTilde.fill(0.);
+
+    for(const Cell &cell: *fluid_)
+        gammaTilde(cell) = gamma(cell);
+
+    gradGammaTilde_->fill(Vector2D(0., 0.));
+    n_->fill(Vector2D(0., 0.));
+    kappa_->fill(0.);
+    fst_->fill(Vector2D(0., 0.));
+
+    std::fill(isInBand_.begin(), isInBand_.end(), false);
+    std::fill(isBandFace_.begin(), isBandFace_.end(), false);
+
+    interfaceCells_.clear();
+
+    for(const Cell &cell: grid_->cells())
+        if(isInterfaceCell(gamma, cell))
+            interfaceCells_.push_back(std::cref(cell));
+
+    buildBand();
+
+    rebuildBand_ = false;
+}
+
+void SurfaceTensionForce::resetBand(const ScalarFiniteVolumeField &gamma)
+{
+    auto &gammaTilde = *gammaTilde_;
+    auto &gradGammaTilde = *gradGammaTilde_;
+    auto &n = *n_;
+    auto &kappa = *kappa_;
+    auto &fst = *fst_;
+
+    for(const Cell &cell: bandCells_)
+    {
+        isInBand_[cell.id()] = false;
+        gammaTilde(cell) = gamma(cell);
+        gradGammaTilde(cell) = Vector2D(0., 0.);
+        n(cell) = Vector2D(0., 0.);
+        kappa(cell) = 0.;
+        fst(cell) = Vector2D(0., 0.);
+    }
+
+    for(const Face &face: bandFaces_)
+    {
+        isBandFace_[face.id()] = false;
+        n(face) = Vector2D(0., 0.);
+        kappa(face) = 0.;
+        fst(face) = Vector2D(0., 0.);
+    }
+}
+
+void SurfaceTensionForce::buildBand()
+{
+    bandCells_.clear();
+    bandFaces_.clear();
+
+    auto addCell = [this](const Cell &cell)
+    {
+        if(!isInBand_[cell.id()] && fluid_->isInSet(cell))
+        {
+            isInBand_[cell.id()] = true;
+            bandCells_.push_back(std::cref(cell));
+        }
+    };
+
+    auto addFace = [this](const Face &face)
+    {
+        if(!isBandFace_[face.id()])
+        {
+            isBandFace_[face.id()] = true;
+            bandFaces_.push_back(std::cref(face));
+        }
+    };
+
+    //- Cells whose smoothing kernel sees the interface
+    for(const Cell &cell: interfaceCells_)
+        for(const Cell &kCell: fluid_->itemsWithin(Circle(cell.centroid(), kernelWidth_)))
+            addCell(kCell);
+
+    //- Extra layers for the gradient and curvature stencils
+    for(int layer = 0, begin = 0; layer < nBandLayers_; ++layer)
+    {
+        int end = bandCells_.size();
+
+        for(int i = begin; i < end; ++i)
+        {
+            const Cell &cell = bandCells_[i];
+
+            for(const InteriorLink &nb: cell.neighbours())
+                addCell(nb.cell());
+
+            for(const CellLink &dg: cell.diagonals())
+                addCell(dg.cell());
+        }
+
+        begin = end;
+    }
+
+    for(const Cell &cell: bandCells_)
+    {
+        for(const InteriorLink &nb: cell.neighbours())
+            addFace(nb.face());
+
+        for(const BoundaryLink &bd: cell.boundaries())
+            addFace(bd.face());
+    }
+}
+
 //Vector2D SurfaceTensionForce::computeCapillaryForce(const ScalarFiniteVolumeField &gamma,
 //                                                    const ImmersedBoundaryObject &ibObj) const
 //{
@@ -8,40 +8,55 @@ class SurfaceTensionForce
 {
 public:
 
+    //- Smoothing kernels of all cells, stored as a sparse operator in CSR format with normalised weights
     class SmoothingKernel
     {
     public:
 
         enum Type{PESKIN, POW_6, POW_8};
 
-        SmoothingKernel(const Cell& cell, Scalar eps, Type type = POW_8);
+        SmoothingKernel()
+        {}
+
+        SmoothingKernel(const CellGroup &cells, Scalar eps, Type type = POW_8);
+
+        void init(const CellGroup &cells, Scalar eps, Type type = POW_8);
 
         void setAxisymmetric(bool axisymmetric);
 
-        const Cell &cell() const
-        { return cell_; }
+        //- Access
+        Size nRows() const
+        { return rowCells_.size(); }
+
+        Index row(const Cell &cell) const
+        { return rowIds_[cell.id()]; }
 
-        Scalar eval(const ScalarFiniteVolumeField &phi) const;
+        //- Smoothed value of a single row, or of every row at once
+        Scalar eval(Label row, const ScalarFiniteVolumeField &phi) const;
+
+        void eval(const ScalarFiniteVolumeField &phi, ScalarFiniteVolumeField &phiTilde) const;
 
     private:
 
-        //        Scalar kernel(Scalar r) const
-        //        { return r < eps_ ? std::cos(M_PI * r / eps_) + 1. : 0.; }
+        Scalar kernel(const Vector2D &dx) const;
 
-        Scalar kcos(Scalar x) const
-        { return x < eps_ ?  eps_ * (1. + std::cos(M_PI * x / eps_)) : 0.; }
+        void computeWeights();
 
-        Scalar kernel(Vector2D dx, Type type) const;
+        const FiniteVolumeGrid2D *grid_ = nullptr;
 
         bool axisymmetric_ = false;
 
         Type type_;
 
-        Scalar eps_, A_;
+        Scalar eps_;
+
+        std::vector<Label> rowCells_;
 
-        const Cell &cell_;
+        std::vector<Index> rowIds_;
 
-        std::vector<Ref<const Cell>> kCells_;
+        std::vector<Label> rowPtr_, colInd_;
+
+        std::vector<Scalar> vals_;
     };
 
     //- Constructor
@@ -87,10 +102,33 @@ public:
 
     void smoothGammaField(const ScalarFiniteVolumeField &gamma);
 
+    //- Narrow band, interface cells plus their kernel support and nBandLayers_ layers of neighbours
+    bool narrowBand() const
+    { return narrowBand_; }
+
+    void updateBand(const ScalarFiniteVolumeField &gamma);
+
+    //- Cells and faces the interface quantities are computed on, the given cells and all faces if the band
+    //  is disabled
+    const std::vector<Ref<const Cell>> &activeCells(const CellGroup &cells) const
+    { return narrowBand_ ? bandCells_ : cells.items(); }
+
+    const std::vector<Ref<const Face>> &activeFaces() const
+    { return narrowBand_ ? bandFaces_ : allFaces_; }
+
 protected:
 
     static SmoothingKernel::Type getKernelType(std::string type);
 
+    bool isInterfaceCell(const ScalarFiniteVolumeField &gamma, const Cell &cell) const
+    { return gamma(cell) > bandTol_ && gamma(cell) < 1. - bandTol_; }
+
+    void rebuildBand(const ScalarFiniteVolumeField &gamma);
+
+    void resetBand(const ScalarFiniteVolumeField &gamma);
+
+    void buildBand();
+
     std::shared_ptr<const FiniteVolumeGrid2D> grid_;
 
     std::shared_ptr<const CellGroup> fluid_;
@@ -103,7 +141,20 @@ protected:
 
     std::unordered_map<std::string, Scalar> patchContactAngles_;
 
-    std::vector<SmoothingKernel> kernels_;
+    SmoothingKernel kernel_;
+
+    //- Narrow band
+    bool narrowBand_, rebuildBand_ = true;
+
+    int nBandLayers_, bandRebuildInterval_, nBandUpdates_ = 0;
+
+    Scalar bandTol_;
+
+    std::vector<Ref<const Cell>> interfaceCells_, bandCells_;
+
+    std::vector<Ref<const Face>> bandFaces_, allFaces_;
+
+    std::vector<bool> isInBand_, isBandFace_;
 
     //- Fields, can share ownership
     std::shared_ptr<VectorFiniteVolumeField> fst_;
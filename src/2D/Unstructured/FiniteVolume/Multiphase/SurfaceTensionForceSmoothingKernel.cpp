@@ -1,60 +1,118 @@
 #include "SurfaceTensionForce.h"
 
-SurfaceTensionForce::SmoothingKernel::SmoothingKernel(const Cell &cell, Scalar eps, Type type)
-    :
-      cell_(cell),
-      eps_(eps),
-      type_(type)
+SurfaceTensionForce::SmoothingKernel::SmoothingKernel(const CellGroup &cells, Scalar eps, Type type)
 {
-    kCells_ = cell_.grid().globalCells().itemsWithin(Circle(cell_.centroid(), eps));
-    setAxisymmetric(false);
+    init(cells, eps, type);
+}
+
+void SurfaceTensionForce::SmoothingKernel::init(const CellGroup &cells, Scalar eps, Type type)
+{
+    eps_ = eps;
+    type_ = type;
+    grid_ = nullptr;
+
+    rowCells_.clear();
+    rowIds_.clear();
+    rowPtr_.assign(1, 0);
+    colInd_.clear();
+
+    if(cells.empty())
+        return;
+
+    grid_ = &cells[0].grid();
+    rowIds_.assign(grid_->cells().size(), -1);
+
+    //- The stencils are only searched for once, the weights are recomputed from them
+    for(const Cell &cell: cells)
+    {
+        rowIds_[cell.id()] = rowCells_.size();
+        rowCells_.push_back(cell.id());
+
+        for(const Cell &kCell: grid_->globalCells().itemsWithin(Circle(cell.centroid(), eps_)))
+            colInd_.push_back(kCell.id());
+
+        rowPtr_.push_back(colInd_.size());
+    }
+
+    computeWeights();
 }
 
 void SurfaceTensionForce::SmoothingKernel::setAxisymmetric(bool axisymmetric)
 {
     axisymmetric_ = axisymmetric;
+    computeWeights();
+}
 
-    A_ = 0.;
+Scalar SurfaceTensionForce::SmoothingKernel::eval(Label row, const ScalarFiniteVolumeField &phi) const
+{
+    Scalar phiTilde = 0.;
 
-    if(axisymmetric_)
-        for(const Cell &kCell: kCells_)
-            A_ += kernel(kCell.centroid() - cell_.centroid(), type_) * kCell.polarVolume();
-    else
-        for(const Cell &kCell: kCells_)
-            A_ += kernel(kCell.centroid() - cell_.centroid(), type_) * kCell.volume();
+    for(Label k = rowPtr_[row]; k < rowPtr_[row + 1]; ++k)
+        phiTilde += vals_[k] * phi(colInd_[k]);
 
-    A_ = 1. / A_;
+    return phiTilde;
 }
 
-Scalar SurfaceTensionForce::SmoothingKernel::eval(const ScalarFiniteVolumeField &phi) const
+void SurfaceTensionForce::SmoothingKernel::eval(const ScalarFiniteVolumeField &phi, ScalarFiniteVolumeField &phiTilde) const
 {
-    Scalar phiTilde = 0.;
+    const Scalar *phiData = phi.data();
 
-    if(axisymmetric_)
-        for(const Cell &kCell: kCells_)
-            phiTilde += phi(kCell) * kernel(kCell.centroid() - cell_.centroid(), type_) * kCell.polarVolume();
-    else
-        for(const Cell &kCell: kCells_)
-            phiTilde += phi(kCell) * kernel(kCell.centroid() - cell_.centroid(), type_) * kCell.volume();
+    for(Label row = 0; row < rowCells_.size(); ++row)
+    {
+        Scalar sum = 0.;
+
+        for(Label k = rowPtr_[row]; k < rowPtr_[row + 1]; ++k)
+            sum += vals_[k] * phiData[colInd_[k]];
 
-    return A_ * phiTilde;
+        phiTilde(rowCells_[row]) = sum;
+    }
 }
 
-Scalar SurfaceTensionForce::SmoothingKernel::kernel(Vector2D dx, Type type) const
+//- Private
+
+Scalar SurfaceTensionForce::SmoothingKernel::kernel(const Vector2D &dx) const
 {
-    switch (type)
+    switch (type_)
     {
     case PESKIN:
+    {
+        auto kcos = [this](Scalar x) { return x < eps_ ? eps_ * (1. + std::cos(M_PI * x / eps_)) : 0.; };
         return kcos(dx.x) * kcos(dx.y);
+    }
     case POW_6:
     {
-        Scalar r = dx.mag();
-        return r < eps_ ? std::pow(std::pow(eps_, 2) - std::pow(r, 2), 3) : 0.;
+        Scalar r2 = dx.magSqr();
+        Scalar d = eps_ * eps_ - r2;
+        return r2 < eps_ * eps_ ? d * d * d : 0.;
     }
     case POW_8:
     {
-        Scalar r = dx.mag();
-        return r < eps_ ? std::pow(std::pow(eps_, 2) - std::pow(r, 2), 4) : 0.;
+        Scalar r2 = dx.magSqr();
+        Scalar d = eps_ * eps_ - r2;
+        return r2 < eps_ * eps_ ? (d * d) * (d * d) : 0.;
     }
     }
+
+    return 0.;
+}
+
+void SurfaceTensionForce::SmoothingKernel::computeWeights()
+{
+    vals_.resize(colInd_.size());
+
+    for(Label row = 0; row < rowCells_.size(); ++row)
+    {
+        const Cell &cell = grid_->cells()[rowCells_[row]];
+        Scalar sum = 0.;
+
+        for(Label k = rowPtr_[row]; k < rowPtr_[row + 1]; ++k)
+        {
+            const Cell &kCell = grid_->cells()[colInd_[k]];
+            vals_[k] = kernel(kCell.centroid() - cell.centroid()) * (axisymmetric_ ? kCell.polarVolume() : kCell.volume());
+            sum += vals_[k];
+        }
+
+        for(Label k = rowPtr_[row]; k < rowPtr_[row + 1]; ++k)
+            vals_[k] /= sum;
+    }
 }
@@ -1,7 +1,48 @@
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/info_parser.hpp>
+
 #include "System/CgnsFile.h"
 
 #include "CgnsUnstructuredGrid.h"
 
+//- Bumped whenever the cache layout changes, old caches are then ignored
+static const uint32_t cacheVersion = 2;
+
+static const char cacheMagic[8] = {'P', 'H', 'G', 'R', 'I', 'D', '\0', '\0'};
+
+static void hashBytes(unsigned long &hash, const char *bytes, Size size)
+{
+    //- 64 bit FNV-1a
+    for (Size i = 0; i < size; ++i)
+    {
+        hash ^= (unsigned char) bytes[i];
+        hash *= 1099511628211ul;
+    }
+}
+
+template<class T>
+static void writeArray(std::ofstream &fout, const std::vector<T> &data)
+{
+    Label size = data.size();
+    fout.write(reinterpret_cast<const char *>(&size), sizeof(Label));
+    fout.write(reinterpret_cast<const char *>(data.data()), sizeof(T) * size);
+}
+
+template<class T>
+static bool readArray(std::ifstream &fin, std::vector<T> &data)
+{
+    Label size;
+    fin.read(reinterpret_cast<char *>(&size), sizeof(Label));
+    data.resize(fin ? size : 0);
+    fin.read(reinterpret_cast<char *>(data.data()), sizeof(T) * data.size());
+    return (bool) fin;
+}
+
 CgnsUnstructuredGrid::CgnsUnstructuredGrid()
         :
         FiniteVolumeGrid2D()
@@ -13,8 +54,34 @@ CgnsUnstructuredGrid::CgnsUnstructuredGrid(const Input &input)
         :
         CgnsUnstructuredGrid()
 {
-    load(input.caseInput().get<std::string>("Grid.filename"),
-         input.caseInput().get<std::string>("Grid.origin", "(0,0)"));
+    std::string filename = input.caseInput().get<std::string>("Grid.filename");
+    Point2D origin = input.caseInput().get<std::string>("Grid.origin", "(0,0)");
+
+    if (!input.caseInput().get<bool>("Grid.cache", false))
+    {
+        load(filename, origin);
+        return;
+    }
+
+    //- Only the main process touches the mesh file to key the cache
+    unsigned long key = comm_->isMainProc() && boost::filesystem::exists(filename) ? cacheKey(input, filename) : 0;
+    key = comm_->broadcast(comm_->mainProcNo(), key);
+
+    if (key == 0)
+        throw Exception("CgnsUnstructuredGrid", "CgnsUnstructuredGrid", "could not open grid file \"" + filename + "\".");
+
+    std::string cache = cacheFilename(input, key);
+
+    if (readCache(cache, key))
+    {
+        comm_->printf("Read grid from cache \"%s\".\n", cache.c_str());
+        return;
+    }
+
+    load(filename, origin);
+
+    if (comm_->isMainProc())
+        writeCache(cache, key);
 }
 
 void CgnsUnstructuredGrid::load(const std::string &filename, const Point2D &origin)
@@ -140,5 +207,140 @@ void CgnsUnstructuredGrid::readPartitionData(const std::string &filename)
         }
     }
 
+    //- Output written before global node and patch face ids were stored keeps the local numbering
+    std::vector<Label> nodeGlobalIds = file.readGlobalIds(1, 1, "Nodes");
+
+    if (nodeGlobalIds.size() == nodes_.size())
+        nodeGlobalIds_ = nodeGlobalIds;
+
+    int nBoCos = file.nBoCos(1, 1);
+
+    for (int bcid = 1; bcid <= nBoCos; ++bcid)
+    {
+        auto boco = file.readBoCo(1, 1, bcid);
+        auto patch = patches_.find(boco.name);
+        std::vector<Label> faceGlobalIds = file.readGlobalIds(1, 1, bcid, "Faces");
+
+        if (patch != patches_.end() && faceGlobalIds.size() == patch->second.size())
+            patchGlobalIds_[boco.name] = faceGlobalIds;
+    }
+
     file.close();
 }
+
+//- Protected
+
+unsigned long CgnsUnstructuredGrid::cacheKey(const Input &input, const std::string &filename) const
+{
+    unsigned long hash = 14695981039346656037ul;
+
+    //- The mesh is identified by its size and modification time, reading it would defeat the cache
+    uintmax_t size = boost::filesystem::file_size(filename);
+    std::time_t mtime = boost::filesystem::last_write_time(filename);
+    std::string path = boost::filesystem::canonical(filename).string();
+
+    hashBytes(hash, path.data(), path.size());
+    hashBytes(hash, reinterpret_cast<const char *>(&size), sizeof(size));
+    hashBytes(hash, reinterpret_cast<const char *>(&mtime), sizeof(mtime));
+
+    std::ostringstream gridInput;
+    boost::property_tree::write_info(gridInput, input.caseInput().get_child("Grid"));
+    hashBytes(hash, gridInput.str().data(), gridInput.str().size());
+    hashBytes(hash, reinterpret_cast<const char *>(&cacheVersion), sizeof(cacheVersion));
+
+    return hash;
+}
+
+std::string CgnsUnstructuredGrid::cacheFilename(const Input &input, unsigned long key) const
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".grid";
+
+    return (boost::filesystem::path(input.caseInput().get<std::string>("Grid.cacheDirectory", "./gridCache"))
+            / name.str()).string();
+}
+
+bool CgnsUnstructuredGrid::readCache(const std::string &filename, unsigned long key)
+{
+    std::ifstream fin(filename, std::ifstream::binary);
+
+    if (!fin.is_open())
+        return false;
+
+    char magic[8];
+    uint32_t version;
+    unsigned long sourceKey;
+
+    fin.read(magic, sizeof(magic));
+    fin.read(reinterpret_cast<char *>(&version), sizeof(version));
+    fin.read(reinterpret_cast<char *>(&sourceKey), sizeof(sourceKey));
+
+    //- The stored key guards against a cache renamed or copied from another mesh
+    if (!fin || !std::equal(magic, magic + sizeof(magic), cacheMagic) || version != cacheVersion || sourceKey != key)
+        return false;
+
+    std::vector<Point2D> nodes;
+    std::vector<Label> cptr, cind;
+    Label nPatches;
+
+    bool isValid = readArray(fin, nodes) && readArray(fin, cptr) && readArray(fin, cind);
+
+    fin.read(reinterpret_cast<char *>(&nPatches), sizeof(Label));
+
+    std::unordered_map<std::string, std::vector<Label>> patches;
+
+    for (Label i = 0; isValid && i < nPatches; ++i)
+    {
+        std::vector<char> name;
+        std::vector<Label> nodeIds;
+
+        isValid = readArray(fin, name) && readArray(fin, nodeIds);
+        patches[std::string(name.begin(), name.end())] = std::move(nodeIds);
+    }
+
+    if (!isValid || !fin)
+        return false;
+
+    init(nodes, cptr, cind, Point2D(0., 0.));
+    initPatches(patches);
+
+    return true;
+}
+
+void CgnsUnstructuredGrid::writeCache(const std::string &filename, unsigned long key) const
+{
+    boost::filesystem::path path(filename);
+
+    if (path.has_parent_path())
+        boost::filesystem::create_directories(path.parent_path());
+
+    //- Written under a temporary name, a run reading the cache never sees a partial file
+    std::string tmpFilename = filename + ".tmp" + std::to_string(::getpid());
+    std::ofstream fout(tmpFilename, std::ofstream::binary);
+
+    fout.write(cacheMagic, sizeof(cacheMagic));
+    fout.write(reinterpret_cast<const char *>(&cacheVersion), sizeof(cacheVersion));
+    fout.write(reinterpret_cast<const char *>(&key), sizeof(key));
+
+    std::vector<int> eptr = this->eptr(), eind = this->eind();
+
+    writeArray(fout, coords());
+    writeArray(fout, std::vector<Label>(eptr.begin(), eptr.end()));
+    writeArray(fout, std::vector<Label>(eind.begin(), eind.end()));
+
+    auto patches = patchToNodeMap();
+    Label nPatches = patches.size();
+    fout.write(reinterpret_cast<const char *>(&nPatches), sizeof(Label));
+
+    for (const auto &patch: patches)
+    {
+        writeArray(fout, std::vector<char>(patch.first.begin(), patch.first.end()));
+        writeArray(fout, std::vector<Label>(patch.second.begin(), patch.second.end()));
+    }
+
+    fout.close();
+
+    boost::filesystem::rename(tmpFilename, filename);
+
+    comm_->printf("Wrote grid cache \"%s\".\n", filename.c_str());
+}
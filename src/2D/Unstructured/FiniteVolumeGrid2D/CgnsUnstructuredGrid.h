@@ -15,6 +15,20 @@ public:
 
     void readPartitionData(const std::string& filename);
 
+protected:
+
+    //- Binary copy of the loaded grid, so repeated runs on the same mesh skip reading the CGNS file. The
+    //  cache is keyed on the path, size and modification time of the mesh file, the Grid input and the cache
+    //  format version. The key is computed by the main process only and stored in the cache header
+    unsigned long cacheKey(const Input &input, const std::string &filename) const;
+
+    std::string cacheFilename(const Input &input, unsigned long key) const;
+
+    //- Returns false if the cache does not exist, was written in another format or for another key
+    bool readCache(const std::string &filename, unsigned long key);
+
+    void writeCache(const std::string &filename, unsigned long key) const;
+
 private:
 
     void readNodes(int fileId, int baseId, int zoneId, int nNodes, Scalar convertToMeters, const Point2D& origin);
@@ -0,0 +1,72 @@
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
+
+#include "BoundaryFaceIndex.h"
+
+BoundaryFaceIndex::BoundaryFaceIndex(const FiniteVolumeGrid2D &grid)
+{
+    init(grid);
+}
+
+void BoundaryFaceIndex::init(const FiniteVolumeGrid2D &grid)
+{
+    namespace bg = boost::geometry;
+
+    segments_.clear();
+    rTree_.clear();
+
+    for (const FaceGroup &patch: grid.patches())
+        for (const Face &face: patch)
+            segments_.push_back(WallSegment{
+                                    LineSegment2D(face.lNode(), face.rNode()),
+                                    face.id(),
+                                    grid.localCells().isInSet(face.lCell())
+                                });
+
+    std::vector<Value> values;
+    values.reserve(segments_.size());
+
+    for (Label i = 0; i < segments_.size(); ++i)
+    {
+        bg::model::box<Point2D> box;
+        bg::envelope(bg::model::segment<Point2D>(segments_[i].edge.ptA(), segments_[i].edge.ptB()), box);
+        values.push_back(std::make_pair(box, i));
+    }
+
+    //- Packing constructor, bulk loads the tree
+    rTree_ = bg::index::rtree<Value, Parameters>(values.begin(), values.end());
+}
+
+void BoundaryFaceIndex::candidates(const Circle &c, std::vector<Ref<const WallSegment>> &result) const
+{
+    namespace bgi = boost::geometry::index;
+
+    result.clear();
+
+    for (auto qit = rTree_.qbegin(bgi::intersects(c.boundingBox())); qit != rTree_.qend(); ++qit)
+        if (segments_[qit->second].isOwned)
+            result.push_back(std::cref(segments_[qit->second]));
+}
+
+std::vector<Ref<const BoundaryFaceIndex::WallSegment>> BoundaryFaceIndex::candidates(const Circle &c) const
+{
+    std::vector<Ref<const WallSegment>> result;
+    candidates(c, result);
+    return result;
+}
+
+void BoundaryFaceIndex::segmentsWithin(const Circle &c, std::vector<Ref<const WallSegment>> &result) const
+{
+    candidates(c, result);
+
+    Scalar rSqr = c.radius() * c.radius();
+
+    result.erase(std::remove_if(result.begin(), result.end(), [&c, rSqr](const WallSegment &seg)
+    { return (seg.nearestPoint(c.centroid()) - c.centroid()).magSqr() > rSqr; }), result.end());
+}
+
+std::vector<Ref<const BoundaryFaceIndex::WallSegment>> BoundaryFaceIndex::segmentsWithin(const Circle &c) const
+{
+    std::vector<Ref<const WallSegment>> result;
+    segmentsWithin(c, result);
+    return result;
+}
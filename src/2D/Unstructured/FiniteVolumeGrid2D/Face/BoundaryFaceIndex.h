@@ -0,0 +1,61 @@
+#ifndef PHASE_BOUNDARY_FACE_INDEX_H
+#define PHASE_BOUNDARY_FACE_INDEX_H
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include "Geometry/Circle.h"
+
+class FiniteVolumeGrid2D;
+
+class BoundaryFaceIndex
+{
+public:
+
+    struct WallSegment
+    {
+        LineSegment2D edge;
+
+        Label faceId;
+
+        bool isOwned;
+
+        Point2D nearestPoint(const Point2D &pt) const
+        { return edge.nearestPoint(pt); }
+    };
+
+    typedef boost::geometry::index::quadratic<8, 4> Parameters;
+
+    typedef std::pair<boost::geometry::model::box<Point2D>, Label> Value;
+
+    BoundaryFaceIndex()
+    {}
+
+    BoundaryFaceIndex(const FiniteVolumeGrid2D &grid);
+
+    //- Initialization, builds the segments and the r-tree from the grid patches
+    void init(const FiniteVolumeGrid2D &grid);
+
+    //- Access
+    Size size() const
+    { return segments_.size(); }
+
+    const std::vector<WallSegment> &segments() const
+    { return segments_; }
+
+    //- Searching, only segments owned by this process are returned
+    void candidates(const Circle &c, std::vector<Ref<const WallSegment>> &result) const;
+
+    std::vector<Ref<const WallSegment>> candidates(const Circle &c) const;
+
+    void segmentsWithin(const Circle &c, std::vector<Ref<const WallSegment>> &result) const;
+
+    std::vector<Ref<const WallSegment>> segmentsWithin(const Circle &c) const;
+
+private:
+
+    std::vector<WallSegment> segments_;
+
+    boost::geometry::index::rtree<Value, Parameters> rTree_;
+};
+
+#endif
@@ -46,6 +46,7 @@ void FiniteVolumeGrid2D::reset()
 {
     //- Node related data
     nodes_.clear();
+    nodeGlobalIds_.clear();
     nodeGroup_.clear();
 
     //- Cell related data
@@ -69,6 +70,7 @@ void FiniteVolumeGrid2D::reset()
 
     //- User defined face groups and patches
     patches_.clear();
+    patchGlobalIds_.clear();
     bBox_ = BoundingBox(Point2D(0., 0.), Point2D(0., 0.));
 }
 
@@ -186,6 +188,9 @@ FaceGroup &FiniteVolumeGrid2D::createPatch(const std::string &name, const std::v
         patch.add(faces_[fid]);
     }
 
+    std::vector<Label> &globalIds = patchGlobalIds_[name] = std::vector<Label>(patch.size());
+    std::iota(globalIds.begin(), globalIds.end(), 0);
+
     return patch;
 }
 
@@ -204,6 +209,9 @@ FaceGroup &FiniteVolumeGrid2D::createPatchByNodes(const std::string &name, const
             insert.first->second = std::cref(patch);
     }
 
+    std::vector<Label> &globalIds = patchGlobalIds_[name] = std::vector<Label>(patch.size());
+    std::iota(globalIds.begin(), globalIds.end(), 0);
+
     return patch;
 }
 
@@ -344,7 +352,7 @@ void FiniteVolumeGrid2D::partition(const Input &input)
     //- Construct the crs representation of the local grid
     comm_->printf("Computing the local cell domains...\n");
     vector<Point2D> nodes;
-    vector<Label> cellInds(1, 0), cellNodeIds, cellProc;
+    vector<Label> cellInds(1, 0), cellNodeIds, cellProc, nodeGlobalIds;
     unordered_map<Label, Label> cellGlobalToLocalIdMap, cellLocalToGlobalIdMap;
     vector<int> localNodeId(nodes_.size(), -1);
     Scalar r = input.caseInput().get<Scalar>("Grid.minBufferWidth", 0.);
@@ -364,6 +372,7 @@ void FiniteVolumeGrid2D::partition(const Input &input)
                 {
                     localNodeId[node.id()] = nodes.size();
                     nodes.push_back(node);
+                    nodeGlobalIds.push_back(node.id());
                 }
 
                 cellNodeIds.push_back(localNodeId[node.id()]);
@@ -372,23 +381,29 @@ void FiniteVolumeGrid2D::partition(const Input &input)
 
     //- Boundary patches
     comm_->printf("Computing the local boundary patches...\n");
-    std::unordered_map<std::string, std::vector<Label>> localPatches;
+    std::unordered_map<std::string, std::vector<Label>> localPatches, localPatchGlobalIds;
 
     for (const FaceGroup &patch: patches())
     {
-        vector<Label> nodeIds;
+        vector<Label> nodeIds, globalIds;
 
-        for (const Face &face: patch)
+        for (Label i = 0; i < patch.size(); ++i)
         {
-            int lid = localNodeId[face.lNode().id()];
-            int rid = localNodeId[face.rNode().id()];
+            int lid = localNodeId[patch[i].lNode().id()];
+            int rid = localNodeId[patch[i].rNode().id()];
 
             if (lid > -1 && rid > -1)
+            {
                 nodeIds.insert(nodeIds.end(), {(Label) lid, (Label) rid});
+                globalIds.push_back(i);
+            }
         }
 
         if (!nodeIds.empty())
+        {
             localPatches[patch.name()] = nodeIds;
+            localPatchGlobalIds[patch.name()] = globalIds;
+        }
     }
 
     //- Now re-initialize local domains
@@ -397,6 +412,10 @@ void FiniteVolumeGrid2D::partition(const Input &input)
     init(nodes, cellInds, cellNodeIds, Point2D(0., 0.));
     initPatches(localPatches);
 
+    //- Keep the original numbering, so output can be reassembled without searching
+    nodeGlobalIds_ = nodeGlobalIds;
+    patchGlobalIds_ = localPatchGlobalIds;
+
     comm_->printf("Finished initializing local domains.\n");
 
     auto nLocalCells = comm_->allGather(localCells_.size());
@@ -473,6 +492,9 @@ void FiniteVolumeGrid2D::init()
     globalIds_.resize(globalCells_.size());
     std::iota(globalIds_.begin(), globalIds_.end(), 0);
 
+    nodeGlobalIds_.resize(nodes_.size());
+    std::iota(nodeGlobalIds_.begin(), nodeGlobalIds_.end(), 0);
+
     bBox_ = BoundingBox(nodes_.begin(), nodes_.end());
 }
 
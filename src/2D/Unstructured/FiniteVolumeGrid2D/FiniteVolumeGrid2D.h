@@ -63,6 +63,10 @@ public:
     std::vector<Point2D> coords() const
     { return std::vector<Point2D>(nodes_.begin(), nodes_.end()); }
 
+    //- Node ids in the grid before partitioning
+    const std::vector<Label> &nodeGlobalIds() const
+    { return nodeGlobalIds_; }
+
     //- Cell related methods
     const std::vector<Cell> &cells() const
     { return cells_; }
@@ -120,6 +124,10 @@ public:
     const FaceGroup &patch(const Face &face) const
     { return patchRegistry_.find(face.id())->second; }
 
+    //- Position of each patch face in the patch before partitioning
+    const std::vector<Label> &patchGlobalIds(const std::string &name) const
+    { return patchGlobalIds_.find(name)->second; }
+
     //- Entity searches
     const Node &findNearestNode(const Point2D &pt) const;
 
@@ -160,6 +168,8 @@ protected:
     //- Node related data
     std::vector<Node> nodes_;
 
+    std::vector<Label> nodeGlobalIds_;
+
     NodeGroup nodeGroup_;
 
     //- Cell related data
@@ -189,6 +199,8 @@ protected:
 
     std::unordered_map<Label, Ref<const FaceGroup>> patchRegistry_;
 
+    std::unordered_map<std::string, std::vector<Label>> patchGlobalIds_;
+
     BoundingBox bBox_;
 };
 
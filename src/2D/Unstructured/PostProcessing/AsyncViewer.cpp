@@ -0,0 +1,125 @@
+#include "AsyncViewer.h"
+
+AsyncViewer::AsyncViewer(const CommandLine &cl,
+                         const Input &input,
+                         const Solver &solver,
+                         std::unique_ptr<Viewer> viewer,
+                         Size maxQueueSize)
+    :
+      Viewer(cl, input, solver),
+      viewer_(std::move(viewer)),
+      maxQueueSize_(std::max(maxQueueSize, Size(1))),
+      isWriting_(false),
+      stop_(false)
+{
+    thread_ = std::thread(&AsyncViewer::run, this);
+}
+
+AsyncViewer::~AsyncViewer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    cv_.notify_all();
+    thread_.join();
+}
+
+void AsyncViewer::write(Scalar solutionTime)
+{
+    std::unique_ptr<Snapshot> snapshot;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        //- Backpressure, the solver waits while the queue is full
+        cv_.wait(lock, [this]() { return queue_.size() < maxQueueSize_ || error_; });
+        rethrow();
+
+        if (!staging_.empty())
+        {
+            snapshot = std::move(staging_.back());
+            staging_.pop_back();
+        }
+    }
+
+    if (!snapshot)
+        snapshot.reset(new Snapshot);
+
+    viewer_->takeSnapshot(solutionTime, *snapshot, true);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(snapshot));
+    }
+
+    cv_.notify_all();
+}
+
+void AsyncViewer::writeSnapshot(const Snapshot &snapshot)
+{
+    flush();
+    viewer_->writeSnapshot(snapshot);
+}
+
+void AsyncViewer::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return (queue_.empty() && !isWriting_) || error_; });
+    rethrow();
+}
+
+void AsyncViewer::run()
+{
+    while (true)
+    {
+        std::unique_ptr<Snapshot> snapshot;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return !queue_.empty() || stop_; });
+
+            //- Pending snapshots are still written when stopping
+            if (queue_.empty())
+                return;
+
+            snapshot = std::move(queue_.front());
+            queue_.pop_front();
+            isWriting_ = true;
+        }
+
+        std::exception_ptr error;
+
+        try
+        {
+            viewer_->writeSnapshot(*snapshot);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            staging_.push_back(std::move(snapshot));
+            isWriting_ = false;
+
+            if (error)
+                error_ = error;
+        }
+
+        cv_.notify_all();
+    }
+}
+
+void AsyncViewer::rethrow()
+{
+    //- Errors from the writer thread are reported on the solver thread
+    if (error_)
+    {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
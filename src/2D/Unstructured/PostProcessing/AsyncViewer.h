@@ -0,0 +1,67 @@
+#ifndef PHASE_ASYNC_VIEWER_H
+#define PHASE_ASYNC_VIEWER_H
+
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#include "Viewer.h"
+
+//- Hands the writes of another viewer to a background thread. Output fields are copied into staging
+//  snapshots and the solver continues while they are written. At most maxQueueSize snapshots wait in
+//  the queue, further writes block until the writer catches up.
+//
+//  The writer thread makes HDF5 calls (directly, or through the CGNS HDF5 backend), and HDF5 is not
+//  thread-safe. Every other HDF5 use on the solver thread, such as checkpoints or image slices, must
+//  be preceded by flush() so no write is in progress. A global lock is not an option with parallel
+//  HDF5, since ranks could then enter collective calls in different orders and deadlock.
+//
+//  MPI is only initialised with MPI_THREAD_MULTIPLE for collective viewers (see
+//  PostProcessing::requiredThreadSupport), otherwise the writer thread must make no MPI calls
+class AsyncViewer : public Viewer
+{
+public:
+
+    AsyncViewer(const CommandLine &cl,
+                const Input &input,
+                const Solver &solver,
+                std::unique_ptr<Viewer> viewer,
+                Size maxQueueSize);
+
+    ~AsyncViewer();
+
+    virtual void write(Scalar solutionTime) override;
+
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
+
+    virtual void flush() override;
+
+protected:
+
+    void run();
+
+    void rethrow();
+
+    std::unique_ptr<Viewer> viewer_;
+
+    Size maxQueueSize_;
+
+    std::deque<std::unique_ptr<Snapshot>> queue_;
+
+    //- Written snapshots, kept so their storage is reused
+    std::vector<std::unique_ptr<Snapshot>> staging_;
+
+    bool isWriting_, stop_;
+
+    std::exception_ptr error_;
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    std::thread thread_;
+};
+
+#endif
@@ -15,7 +15,9 @@ CgnsViewer::CgnsViewer(const CommandLine &cl, const Input &input, const Solver &
     :
       Viewer(cl, input, solver)
 {
-    boost::filesystem::path path = "solution/Proc" + std::to_string(solver.grid()->comm().rank());
+    procNo_ = solver.grid()->comm().rank();
+
+    boost::filesystem::path path = "solution/Proc" + std::to_string(procNo_);
     boost::filesystem::create_directories(path);
 
     casename_ = input.caseInput().get<std::string>("CaseName");
@@ -51,6 +53,8 @@ CgnsViewer::CgnsViewer(const CommandLine &cl, const Input &input, const Solver &
         int sid = file.writeBarElementSection(bid, zid, (patch.name() + "Elements"), start, end, elems);
         int bcid = file.writeBoCo(bid, zid, patch.name(), start, end);
 
+        file.writeGlobalIds(bid, zid, bcid, "Faces", solver.grid()->patchGlobalIds(patch.name()));
+
         start = end + 1;
     }
 
@@ -59,13 +63,15 @@ CgnsViewer::CgnsViewer(const CommandLine &cl, const Input &input, const Solver &
     file.writeField(bid, zid, sid, "ProcNo", solver.grid()->cellOwnership());
     file.writeField(bid, zid, sid, "GlobalID", solver.grid()->globalIds());
 
+    file.writeGlobalIds(bid, zid, "Nodes", solver.grid()->nodeGlobalIds());
+
     file.close();
 }
 
-void CgnsViewer::write(Scalar time)
+void CgnsViewer::writeSnapshot(const Snapshot &snapshot)
 {
-    boost::filesystem::path path = "solution/" + std::to_string(time)
-            + "/Proc" + std::to_string(solver_.grid()->comm().rank());
+    boost::filesystem::path path = "solution/" + std::to_string(snapshot.time)
+            + "/Proc" + std::to_string(procNo_);
 
     boost::filesystem::create_directories(path);
 
@@ -77,26 +83,14 @@ void CgnsViewer::write(Scalar time)
 
     int sid = file.writeSolution(bid, zid, "Solution");
 
-    for (const std::string &fieldname: integerFields_)
-    {
-        auto field = solver_.integerField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.integerFields)
+        file.writeField(bid, zid, sid, field.name, field.data, field.size);
 
-    for (const std::string &fieldname: scalarFields_)
-    {
-        auto field = solver_.scalarField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.scalarFields)
+        file.writeField(bid, zid, sid, field.name, field.data, field.size);
 
-    for (const std::string &fieldname: vectorFields_)
-    {
-        auto field = solver_.vectorField(fieldname);
-        if (field)
-            file.writeField(bid, zid, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.vectorFields)
+        file.writeField(bid, zid, sid, field.name, field.data, field.size);
 
     path = boost::filesystem::path("../../../") / gridfile_;
 
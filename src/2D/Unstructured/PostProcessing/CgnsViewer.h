@@ -13,11 +13,14 @@ public:
 
     CgnsViewer(const CommandLine &cl, const Input& input, const Solver& solver);
 
-    virtual void write(Scalar time) override;
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
 
 protected:
 
     std::string path_, gridfile_, casename_;
+
+    //- Cached so that an asynchronous writer thread makes no MPI calls
+    int procNo_;
 };
 
 #endif
@@ -55,37 +55,26 @@ CompactCgnsViewer::CompactCgnsViewer(const CommandLine &cl, const Input &input,
         int sid = file.writeSolution(bid_, zid_, "Info");
         file.writeField(bid_, zid_, sid, "ProcNo", solver.grid()->cellOwnership());
         file.writeField(bid_, zid_, sid, "GlobalID", solver.grid()->globalIds());
+        file.writeGlobalIds(bid_, zid_, "Nodes", solver.grid()->nodeGlobalIds());
         file.close();
     }
 }
 
-void CompactCgnsViewer::write(Scalar time)
+void CompactCgnsViewer::writeSnapshot(const Snapshot &snapshot)
 {
     CgnsFile file(filename_, CgnsFile::MODIFY);
 
     int sid = file.writeSolution(bid_, zid_, "FlowSolution" + std::to_string(++solnNo_));
-    file.writeDescriptorNode(bid_, zid_, sid, "SolutionTime", std::to_string(time));
+    file.writeDescriptorNode(bid_, zid_, sid, "SolutionTime", std::to_string(snapshot.time));
 
-    for (const std::string &fieldname: integerFields_)
-    {
-        auto field = solver_.integerField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.integerFields)
+        file.writeField(bid_, zid_, sid, field.name, field.data, field.size);
 
-    for (const std::string &fieldname: scalarFields_)
-    {
-        auto field = solver_.scalarField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.scalarFields)
+        file.writeField(bid_, zid_, sid, field.name, field.data, field.size);
 
-    for (const std::string &fieldname: vectorFields_)
-    {
-        auto field = solver_.vectorField(fieldname);
-        if (field)
-            file.writeField(bid_, zid_, sid, field->name(), *field);
-    }
+    for (const auto &field: snapshot.vectorFields)
+        file.writeField(bid_, zid_, sid, field.name, field.data, field.size);
 
     file.close();
 }
@@ -9,7 +9,7 @@ public:
 
     CompactCgnsViewer(const CommandLine &cl, const Input& input, const Solver& solver);
 
-    virtual void write(Scalar time) override;
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
 
 protected:
 
@@ -0,0 +1,143 @@
+#include <limits>
+
+#include "FieldProbes.h"
+
+FieldProbes::FieldProbes(int fileWriteFreq,
+                         const std::string &name,
+                         const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+                         const std::vector<Point2D> &points)
+    :
+      Object(fileWriteFreq),
+      name_(name),
+      scalarField_(field),
+      nComponents_(1)
+{
+    init(field.lock()->grid(), points);
+}
+
+FieldProbes::FieldProbes(int fileWriteFreq,
+                         const std::string &name,
+                         const std::weak_ptr<const VectorFiniteVolumeField> &field,
+                         const std::vector<Point2D> &points)
+    :
+      Object(fileWriteFreq),
+      name_(name),
+      vectorField_(field),
+      nComponents_(2)
+{
+    init(field.lock()->grid(), points);
+}
+
+std::vector<Point2D> FieldProbes::linePoints(const Point2D &start, const Point2D &end, int nPoints)
+{
+    std::vector<Point2D> points;
+
+    for (int i = 0; i < nPoints; ++i)
+        points.push_back(nPoints > 1 ? start + (end - start) * i / (nPoints - 1) : start);
+
+    return points;
+}
+
+void FieldProbes::compute(Scalar time, bool force)
+{
+    if (do_update() || force)
+    {
+        std::vector<Scalar> values;
+        values.reserve(nComponents_ * interpolators_.size());
+
+        for (Label k = 0; k < interpolators_.size(); ++k)
+        {
+            const BilinearInterpolator &bi = interpolators_[k];
+
+            if (nComponents_ == 1)
+            {
+                const ScalarFiniteVolumeField &field = *scalarField_.lock();
+                values.push_back(bi.isValid() ? bi(field) : field[cellIds_[k]]);
+            }
+            else
+            {
+                const VectorFiniteVolumeField &field = *vectorField_.lock();
+                Vector2D value = bi.isValid() ? bi(field) : field[cellIds_[k]];
+                values.insert(values.end(), {value.x, value.y});
+            }
+        }
+
+        const Communicator &comm = grid_.lock()->comm();
+
+        values = comm.gatherv(comm.mainProcNo(), values);
+
+        if (comm.isMainProc())
+        {
+            std::vector<Scalar> row(nComponents_ * nPoints_, std::numeric_limits<Scalar>::quiet_NaN());
+
+            for (Label i = 0; i < gatheredIds_.size(); ++i)
+                for (int j = 0; j < nComponents_; ++j)
+                    row[nComponents_ * gatheredIds_[i] + j] = values[nComponents_ * i + j];
+
+            std::ofstream fout(getFilename(), std::ofstream::app);
+
+            fout << time;
+
+            for (Scalar value: row)
+                fout << "," << value;
+
+            fout << "\n";
+            fout.close();
+        }
+    }
+}
+
+//- Protected
+
+void FieldProbes::init(const std::shared_ptr<const FiniteVolumeGrid2D> &grid, const std::vector<Point2D> &points)
+{
+    const Communicator &comm = grid->comm();
+
+    grid_ = grid;
+
+    path_ /= "FieldProbes";
+    nPoints_ = points.size();
+
+    //- The containing cell is one of the nearest owned cells, but not necessarily the nearest
+    for (Label i = 0; i < points.size(); ++i)
+        for (const Cell &cell: grid->localCells().nearestItems(points[i], 4))
+            if (cell.isInCell(points[i]))
+            {
+                localIds_.push_back(i);
+                cellIds_.push_back(cell.id());
+                interpolators_.push_back(BilinearInterpolator(grid, points[i]));
+                break;
+            }
+
+    gatheredIds_ = comm.gatherv(comm.mainProcNo(), localIds_);
+
+    if (comm.isMainProc())
+    {
+        createOutputDirectory();
+
+        std::ofstream fout((path_ / (name_ + "_points.csv")).string());
+        fout << "point,x,y\n";
+
+        for (Label i = 0; i < points.size(); ++i)
+            fout << i << "," << points[i].x << "," << points[i].y << "\n";
+
+        fout.close();
+
+        fout.open(getFilename());
+        fout << "time";
+
+        for (Label i = 0; i < points.size(); ++i)
+            if (nComponents_ == 1)
+                fout << ",p" << i;
+            else
+                fout << ",p" << i << "_x,p" << i << "_y";
+
+        fout << "\n";
+        fout.close();
+    }
+}
+
+std::string FieldProbes::getFilename() const
+{
+    return (path_ / (name_ + ".csv")).string();
+}
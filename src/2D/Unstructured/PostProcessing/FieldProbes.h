@@ -0,0 +1,58 @@
+#ifndef PHASE_FIELD_PROBES_H
+#define PHASE_FIELD_PROBES_H
+
+#include "FiniteVolumeGrid2D/BilinearInterpolator.h"
+
+#include "PostProcessing.h"
+
+//- Samples a scalar or vector field at fixed points. Each point is interpolated by the process owning the
+//  cell that contains it, and the main process writes one row per sample with a column per point
+//  (per component for vectors). Points without a full bilinear stencil, such as those near a boundary,
+//  take the value of their cell. Points outside the domain are written as nan
+class FieldProbes : public PostProcessing::Object
+{
+public:
+
+    FieldProbes(int fileWriteFreq,
+                const std::string &name,
+                const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+                const std::vector<Point2D> &points);
+
+    FieldProbes(int fileWriteFreq,
+                const std::string &name,
+                const std::weak_ptr<const VectorFiniteVolumeField> &field,
+                const std::vector<Point2D> &points);
+
+    //- Evenly spaced points on a line segment, including both ends
+    static std::vector<Point2D> linePoints(const Point2D &start, const Point2D &end, int nPoints);
+
+    void compute(Scalar time, bool force = false) override;
+
+protected:
+
+    void init(const std::shared_ptr<const FiniteVolumeGrid2D> &grid, const std::vector<Point2D> &points);
+
+    std::string getFilename() const;
+
+    std::string name_;
+
+    std::weak_ptr<const FiniteVolumeGrid2D> grid_;
+
+    std::weak_ptr<const ScalarFiniteVolumeField> scalarField_;
+
+    std::weak_ptr<const VectorFiniteVolumeField> vectorField_;
+
+    int nComponents_;
+
+    Size nPoints_;
+
+    //- Points owned by this process, their containing cells and their stencils, which may be invalid
+    std::vector<Label> localIds_, cellIds_;
+
+    std::vector<BilinearInterpolator> interpolators_;
+
+    //- Point ids in the order the main process receives the sampled values
+    std::vector<Label> gatheredIds_;
+};
+
+#endif
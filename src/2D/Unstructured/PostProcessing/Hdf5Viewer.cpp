@@ -0,0 +1,318 @@
+#include <fstream>
+#include <numeric>
+#include <cmath>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "System/Exception.h"
+
+#include "Hdf5Viewer.h"
+
+Hdf5Viewer::Hdf5Viewer(const CommandLine &cl, const Input &input, const Solver &solver)
+    :
+      Viewer(cl, input, solver),
+      isMainProc_(solver.comm().isMainProc())
+{
+    boost::filesystem::path path = "./solution";
+
+    if (solver.comm().isMainProc())
+        boost::filesystem::create_directory(path);
+
+    solver.comm().barrier();
+
+    std::string casename = input.caseInput().get<std::string>("CaseName");
+    h5filename_ = casename + ".h5";
+    xdmfFilename_ = (path / (casename + ".xmf")).string();
+
+    timeChunkSize_ = input.postProcessingInput().get<hsize_t>("PostProcessing.timeChunkSize", 8);
+    cellChunkSize_ = input.postProcessingInput().get<hsize_t>("PostProcessing.cellChunkSize", 32768);
+
+    //- Output formats, the entries of Output.Fields override the defaults for single fields
+    FieldFormat lossless;
+    lossless.singlePrecision = false;
+
+    auto outputInput = input.postProcessingInput().get_child_optional("PostProcessing.Output");
+
+    defaultFormat_ = outputInput ? readFieldFormat(outputInput.get(), lossless) : lossless;
+
+    if (outputInput)
+    {
+        auto fieldInputs = outputInput.get().get_child_optional("Fields");
+
+        if (fieldInputs)
+            for (const auto &fieldInput: fieldInputs.get())
+                fieldFormats_[fieldInput.first] = readFieldFormat(fieldInput.second, defaultFormat_);
+    }
+
+    const FiniteVolumeGrid2D &grid = *solver.grid();
+
+    for (const Cell &cell: grid.localCells())
+    {
+        localIds_.push_back(cell.id());
+        globalIds_.push_back(grid.globalIds()[cell.id()]);
+    }
+
+    nGlobalCells_ = solver.comm().sum((unsigned long) localIds_.size());
+    cellChunkSize_ = std::max(std::min(cellChunkSize_, nGlobalCells_), hsize_t(1));
+
+    //- A restarted run appends to the existing time series
+    if (isRestart_ && boost::filesystem::exists(path / h5filename_))
+    {
+        file_.open((path / h5filename_).string(), Hdf5File::MODIFY, solver.comm());
+
+        times_ = file_.read<Scalar>("/Time");
+        nodesPerCell_ = file_.dims("/Grid/Topology")[1];
+        nGlobalNodes_ = file_.dims("/Grid/Coordinates")[0];
+    }
+    else
+    {
+        file_.open((path / h5filename_).string(), Hdf5File::WRITE, solver.comm());
+        writeGrid();
+    }
+}
+
+void Hdf5Viewer::writeSnapshot(const Snapshot &snapshot)
+{
+    hsize_t step = times_.size();
+
+    times_.push_back(snapshot.time);
+
+    file_.extend("/Time", {step + 1});
+    file_.write("/Time", &snapshot.time, {isMainProc_ ? step : 0}, {isMainProc_ ? 1ul : 0ul});
+
+    fields_.clear();
+
+    for (const auto &field: snapshot.integerFields)
+        writeField(field.name, field.data, field.size, 1);
+
+    for (const auto &field: snapshot.scalarFields)
+        writeField(field.name, field.data, field.size, 1);
+
+    for (const auto &field: snapshot.vectorFields)
+        writeField(field.name, reinterpret_cast<const Scalar *>(field.data), 2 * field.size, 2);
+
+    file_.flush();
+
+    if (isMainProc_)
+        writeXdmf();
+}
+
+void Hdf5Viewer::writeGrid()
+{
+    const FiniteVolumeGrid2D &grid = *solver_.grid();
+    const Communicator &comm = solver_.comm();
+
+    //- Nodes keep their numbering from before partitioning. A node is written by the lowest process owning
+    //  one of its cells, which holds all cells around the node in its buffer
+    const std::vector<Label> &nodeGlobalIds = grid.nodeGlobalIds();
+    std::vector<hsize_t> nodeIds, nodeFileIds;
+    Label maxNodeGlobalId = 0;
+
+    for (const Node &node: grid.nodes())
+    {
+        Label owner = comm.nProcs();
+
+        for (const Cell &cell: node.cells())
+            owner = std::min(owner, grid.cellOwnership()[cell.id()]);
+
+        if (owner != comm.rank())
+            continue;
+
+        nodeIds.push_back(node.id());
+        nodeFileIds.push_back(nodeGlobalIds[node.id()]);
+
+        maxNodeGlobalId = std::max(maxNodeGlobalId, nodeGlobalIds[node.id()]);
+    }
+
+    nGlobalNodes_ = comm.max((Scalar) maxNodeGlobalId) + 1;
+
+    Size nodesPerCell = 0;
+    for (Label id: localIds_)
+        nodesPerCell = std::max(nodesPerCell, grid.cells()[id].nodes().size());
+
+    nodesPerCell_ = comm.max((Scalar) nodesPerCell);
+
+    file_.createGroup("/Grid");
+    file_.createGroup("/Fields");
+
+    file_.createDataset<Scalar>("/Grid/Coordinates",
+                                {nGlobalNodes_, 2},
+                                {nGlobalNodes_, 2},
+                                {std::max(std::min(nGlobalNodes_, cellChunkSize_), hsize_t(1)), 2});
+
+    auto coords = grid.coords();
+    file_.write("/Grid/Coordinates", reinterpret_cast<const Scalar *>(coords.data()), 2 * coords.size(),
+                nodeIds, nodeFileIds);
+
+    //- Cells with fewer nodes are padded by repeating their last node
+    std::vector<long> topology;
+    std::vector<int> procNo(localIds_.size(), comm.rank());
+    std::vector<hsize_t> cellIds(localIds_.size());
+
+    topology.reserve(nodesPerCell_ * localIds_.size());
+
+    for (Label i = 0; i < localIds_.size(); ++i)
+    {
+        const auto &nodes = grid.cells()[localIds_[i]].nodes();
+
+        for (hsize_t j = 0; j < nodesPerCell_; ++j)
+            topology.push_back(nodeGlobalIds[nodes[std::min<Label>(j, nodes.size() - 1)].get().id()]);
+    }
+
+    std::iota(cellIds.begin(), cellIds.end(), 0);
+
+    file_.createDataset<long>("/Grid/Topology",
+                              {nGlobalCells_, nodesPerCell_},
+                              {nGlobalCells_, nodesPerCell_},
+                              {cellChunkSize_, nodesPerCell_});
+
+    file_.write("/Grid/Topology", topology.data(), topology.size(), cellIds, globalIds_);
+
+    file_.createDataset<int>("/Grid/ProcNo", {nGlobalCells_}, {nGlobalCells_}, {cellChunkSize_});
+    file_.write("/Grid/ProcNo", procNo.data(), procNo.size(), cellIds, globalIds_);
+
+    file_.createDataset<Scalar>("/Time", {0}, {H5S_UNLIMITED}, {timeChunkSize_});
+}
+
+template<class T>
+void Hdf5Viewer::writeField(const std::string &name, const T *data, hsize_t size, hsize_t nComponents)
+{
+    std::string path = "/Fields/" + name;
+    hsize_t step = times_.size() - 1;
+
+    //- Chunks span several steps so the history of a region is read from few chunks
+    std::vector<hsize_t> dims = {step + 1, nGlobalCells_}, chunk = {timeChunkSize_, cellChunkSize_};
+
+    if (nComponents > 1)
+    {
+        dims.push_back(nComponents);
+        chunk.push_back(nComponents);
+    }
+
+    const FieldFormat &format = fieldFormat(name);
+    bool isSingle = std::is_floating_point<T>::value && format.singlePrecision;
+
+    if (!file_.exists(path))
+    {
+        std::vector<hsize_t> maxDims = dims;
+        maxDims[0] = H5S_UNLIMITED;
+
+        //- The conversion to single precision happens inside the write
+        if (isSingle)
+            file_.createDataset<float>(path, dims, maxDims, chunk, format.filters);
+        else
+            file_.createDataset<T>(path, dims, maxDims, chunk, format.filters);
+    }
+    else
+        file_.extend(path, dims);
+
+    file_.write(path, data, size, localIds_, globalIds_, {step});
+
+    fields_.push_back(Attribute{name, std::is_integral<T>::value ? "Int" : "Float", nComponents,
+                                isSingle ? sizeof(float) : sizeof(T)});
+}
+
+Hdf5Viewer::FieldFormat Hdf5Viewer::readFieldFormat(const boost::property_tree::ptree &input,
+                                                    const FieldFormat &defaultFormat)
+{
+    FieldFormat format = defaultFormat;
+
+    auto precision = input.get_optional<std::string>("precision");
+
+    if (precision)
+    {
+        if (precision.get() != "float" && precision.get() != "double")
+            throw Exception("Hdf5Viewer", "readFieldFormat", "unrecognized precision \"" + precision.get() + "\".");
+
+        format.singlePrecision = precision.get() == "float";
+    }
+
+    auto compression = input.get_optional<std::string>("compression");
+
+    if (compression)
+    {
+        int level = input.get<int>("compressionLevel", compression.get() == "zstd" ? 3 : 4);
+
+        format.filters.deflateLevel = 0;
+        format.filters.zstdLevel = 0;
+
+        if (compression.get() == "deflate")
+            format.filters.deflateLevel = level;
+        else if (compression.get() == "zstd")
+            format.filters.zstdLevel = level;
+        else if (compression.get() != "none")
+            throw Exception("Hdf5Viewer", "readFieldFormat", "unrecognized compression \"" + compression.get() + "\".");
+
+        format.filters.shuffle = compression.get() != "none";
+    }
+
+    format.filters.shuffle = input.get<bool>("shuffle", format.filters.shuffle);
+
+    //- Lossy storage, values are kept to the decimal digits that guarantee the absolute error bound
+    auto errorBound = input.get_optional<Scalar>("errorBound");
+
+    if (errorBound)
+        format.filters.decimalDigits = errorBound.get() > 0.
+                                       ? std::max(0, (int) std::ceil(-std::log10(2. * errorBound.get())))
+                                       : -1;
+
+    return format;
+}
+
+const Hdf5Viewer::FieldFormat &Hdf5Viewer::fieldFormat(const std::string &name) const
+{
+    auto it = fieldFormats_.find(name);
+    return it != fieldFormats_.end() ? it->second : defaultFormat_;
+}
+
+void Hdf5Viewer::writeXdmf() const
+{
+    std::string topologyType = nodesPerCell_ == 3 ? "Triangle" : nodesPerCell_ == 4 ? "Quadrilateral" : "Polygon";
+    std::ofstream fout(xdmfFilename_);
+
+    fout << "<?xml version=\"1.0\" ?>\n"
+         << "<Xdmf Version=\"3.0\">\n"
+         << "  <Domain>\n"
+         << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+    for (hsize_t step = 0; step < times_.size(); ++step)
+    {
+        fout << "      <Grid Name=\"Solution" << step << "\" GridType=\"Uniform\">\n"
+             << "        <Time Value=\"" << times_[step] << "\"/>\n"
+             << "        <Topology TopologyType=\"" << topologyType << "\" NumberOfElements=\"" << nGlobalCells_
+             << "\" NodesPerElement=\"" << nodesPerCell_ << "\">\n"
+             << "          <DataItem Dimensions=\"" << nGlobalCells_ << " " << nodesPerCell_
+             << "\" NumberType=\"Int\" Precision=\"8\" Format=\"HDF\">" << h5filename_ << ":/Grid/Topology</DataItem>\n"
+             << "        </Topology>\n"
+             << "        <Geometry GeometryType=\"XY\">\n"
+             << "          <DataItem Dimensions=\"" << nGlobalNodes_
+             << " 2\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">" << h5filename_ << ":/Grid/Coordinates</DataItem>\n"
+             << "        </Geometry>\n";
+
+        for (const Attribute &attr: fields_)
+        {
+            bool isVector = attr.nComponents > 1;
+            std::string nc = isVector ? " " + std::to_string(attr.nComponents) : "";
+
+            fout << "        <Attribute Name=\"" << attr.name << "\" AttributeType=\"" << (isVector ? "Vector" : "Scalar")
+                 << "\" Center=\"Cell\">\n"
+                 << "          <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << nGlobalCells_ << nc << "\">\n"
+                 << "            <DataItem Dimensions=\"3 " << (isVector ? 3 : 2) << "\" Format=\"XML\">"
+                 << step << " 0" << (isVector ? " 0" : "") << " "
+                 << "1 1" << (isVector ? " 1" : "") << " "
+                 << "1 " << nGlobalCells_ << nc << "</DataItem>\n"
+                 << "            <DataItem Dimensions=\"" << times_.size() << " " << nGlobalCells_ << nc
+                 << "\" NumberType=\"" << attr.numberType << "\" Precision=\"" << attr.precision
+                 << "\" Format=\"HDF\">" << h5filename_ << ":/Fields/" << attr.name << "</DataItem>\n"
+                 << "          </DataItem>\n"
+                 << "        </Attribute>\n";
+        }
+
+        fout << "      </Grid>\n";
+    }
+
+    fout << "    </Grid>\n"
+         << "  </Domain>\n"
+         << "</Xdmf>\n";
+}
@@ -0,0 +1,72 @@
+#ifndef PHASE_HDF5_VIEWER_H
+#define PHASE_HDF5_VIEWER_H
+
+#include "System/Hdf5File.h"
+
+#include "Viewer.h"
+
+//- Writes the whole run into a single HDF5 file shared by all processes. Cell data is stored in the
+//  global cell ordering, one extendible dataset per field, and an XDMF file describes the time series.
+//  The output is meant for viewing, so precision and compression can be set per field in the
+//  PostProcessing.Output block
+class Hdf5Viewer : public Viewer
+{
+public:
+
+    Hdf5Viewer(const CommandLine &cl, const Input &input, const Solver &solver);
+
+    virtual void writeSnapshot(const Snapshot &snapshot) override;
+
+    //- Writes go through MPI-IO
+    virtual bool isCollective() const override
+    { return true; }
+
+protected:
+
+    struct Attribute
+    {
+        std::string name, numberType;
+        hsize_t nComponents, precision;
+    };
+
+    //- How a field is stored, floating point data can be down-cast to single precision
+    struct FieldFormat
+    {
+        bool singlePrecision;
+
+        Hdf5File::Filters filters;
+    };
+
+    static FieldFormat readFieldFormat(const boost::property_tree::ptree &input, const FieldFormat &defaultFormat);
+
+    const FieldFormat &fieldFormat(const std::string &name) const;
+
+    void writeGrid();
+
+    //- Writes the owned cells straight from the field storage, data holds size values
+    template<class T>
+    void writeField(const std::string &name, const T *data, hsize_t size, hsize_t nComponents);
+
+    void writeXdmf() const;
+
+    std::string h5filename_, xdmfFilename_;
+
+    bool isMainProc_;
+
+    Hdf5File file_;
+
+    //- Owned cells, local ids and their position in the global ordering
+    std::vector<hsize_t> localIds_, globalIds_;
+
+    hsize_t nGlobalCells_, nGlobalNodes_, nodesPerCell_, timeChunkSize_, cellChunkSize_;
+
+    std::vector<Scalar> times_;
+
+    std::vector<Attribute> fields_;
+
+    FieldFormat defaultFormat_;
+
+    std::unordered_map<std::string, FieldFormat> fieldFormats_;
+};
+
+#endif
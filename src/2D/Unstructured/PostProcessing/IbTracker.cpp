@@ -1,34 +1,32 @@
+#include <sstream>
+
 #include "IbTracker.h"
 
 IbTracker::IbTracker(int fileWriteFreq,
                      const std::weak_ptr<const ImmersedBoundary> &ib,
                      double lineThickness,
-                     const std::string &fillColor)
+                     const std::string &fillColor,
+                     int flushFrequency)
         :
         Object(fileWriteFreq),
         lineThickness_(lineThickness),
         fillColor_(fillColor),
-        ib_(ib)
+        ib_(ib),
+        writer_(flushFrequency)
 {
     path_ /= "IbTracker";
 
     if (ib_.lock()->grid()->comm().isMainProc())
-    {
         createOutputDirectory();
 
-        for (const auto &ibObj: *ib_.lock())
+    for (const auto &ibObj: *ib_.lock())
+        if (ib_.lock()->isOutputProc(*ibObj))
         {
-
-
-            std::ofstream fout((path_ / (ibObj->name() + ".dat")).string());
-            fout << "Title = \"" << ibObj->name() << "\"\n";
-            fout.close();
-
-            fout.open((path_ / (ibObj->name() + "_time_series.csv")).string());
-            fout << "time,x,y,theta,vx,vy,omega,fx,fy,tau\n";
-            fout.close();
+            writer_.create((path_ / (ibObj->name() + ".dat")).string(), "Title = \"" + ibObj->name() + "\"\n");
+            writer_.create((path_ / (ibObj->name() + "_time_series.csv")).string(), "time,x,y,theta,vx,vy,omega,fx,fy,tau\n");
         }
-    }
+
+    writer_.sync(ib_.lock()->grid()->comm());
 }
 
 void IbTracker::compute(Scalar time, bool force)
@@ -37,11 +35,10 @@ void IbTracker::compute(Scalar time, bool force)
     if (do_update() || force)
     {
         //- Loop over remaining
-        if (ib_.lock()->grid()->comm().isMainProc())
-            for (const auto& ibObj: *ib_.lock())
+        for (const auto& ibObj: *ib_.lock())
+            if (ib_.lock()->isOutputProc(*ibObj))
             {
-                std::ofstream fout((path_ / (ibObj->name() + ".dat")).string(),
-                                   std::ofstream::out | std::ofstream::app);
+                std::ostringstream fout;
 
                 //- Add a geometry record for this zone
                 switch (ibObj->shape().type())
@@ -78,11 +75,9 @@ void IbTracker::compute(Scalar time, bool force)
                     }
                 }
 
-                fout.close();
-
-                fout.open((path_ / (ibObj->name() + "_time_series.csv")).string(),
-                          std::ofstream::out | std::ofstream::app);
+                writer_.append((path_ / (ibObj->name() + ".dat")).string(), fout.str());
 
+                fout.str("");
                 fout << time << ","
                      << ibObj->position().x << ","
                      << ibObj->position().y << ","
@@ -94,9 +89,11 @@ void IbTracker::compute(Scalar time, bool force)
                      << ibObj->force().y << ","
                      << ibObj->torque() << "\n";
 
-                fout.close();
+                writer_.append((path_ / (ibObj->name() + "_time_series.csv")).string(), fout.str());
             }
 
+        writer_.sync(ib_.lock()->grid()->comm());
+
         zoneNo_++;
     }
 }
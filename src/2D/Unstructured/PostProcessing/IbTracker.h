@@ -1,6 +1,8 @@
 #ifndef PHASE_IB_TRACKER_H
 #define PHASE_IB_TRACKER_H
 
+#include "System/TimeSeriesWriter.h"
+
 #include "PostProcessing.h"
 #include "FiniteVolume/ImmersedBoundary/ImmersedBoundary.h"
 
@@ -11,10 +13,14 @@ public:
     IbTracker(int fileWriteFreq,
               const std::weak_ptr<const ImmersedBoundary> &ib,
               double lineThickness = 0.4,
-              const std::string &fillColor = "CUST2");
+              const std::string &fillColor = "CUST2",
+              int flushFrequency = 100);
 
     void compute(Scalar time, bool force = false) override;
 
+    void flush() override
+    { writer_.flush(); }
+
 private:
 
     std::weak_ptr<const ImmersedBoundary> ib_;
@@ -24,6 +30,9 @@ private:
     double lineThickness_ = 0.4;
 
     std::string fillColor_ = "CUST2";
+
+    //- Rows of all objects are gathered and written by the main process
+    TimeSeriesWriter writer_;
 };
 
 
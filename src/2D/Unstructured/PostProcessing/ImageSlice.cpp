@@ -0,0 +1,78 @@
+#include "ImageSlice.h"
+
+ImageSlice::ImageSlice(int fileWriteFreq,
+                       const std::string &name,
+                       const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+                       const Point2D &lower,
+                       const Point2D &upper,
+                       hsize_t nx,
+                       hsize_t ny)
+    :
+      Object(fileWriteFreq),
+      field_(field),
+      nx_(std::max(nx, hsize_t(1))),
+      ny_(std::max(ny, hsize_t(1))),
+      nSteps_(0)
+{
+    const FiniteVolumeGrid2D &grid = *field_.lock()->grid();
+    const Communicator &comm = grid.comm();
+
+    path_ /= "ImageSlices";
+
+    if (comm.isMainProc())
+        createOutputDirectory();
+
+    comm.barrier();
+
+    //- The pixel map is fixed, the grid does not change during a run
+    Vector2D spacing((upper.x - lower.x) / nx_, (upper.y - lower.y) / ny_);
+
+    for (hsize_t j = 0; j < ny_; ++j)
+        for (hsize_t i = 0; i < nx_; ++i)
+        {
+            Point2D pt(lower.x + (i + 0.5) * spacing.x, lower.y + (j + 0.5) * spacing.y);
+
+            for (const Cell &cell: grid.localCells().nearestItems(pt, 4))
+                if (cell.isInCell(pt))
+                {
+                    pixels_.push_back(j * nx_ + i);
+                    memIds_.push_back(memIds_.size());
+                    cellIds_.push_back(cell.id());
+                    break;
+                }
+        }
+
+    file_.open((path_ / (name + ".h5")).string(), Hdf5File::WRITE, comm);
+
+    std::vector<Scalar> extent = {lower.x, lower.y, upper.x, upper.y};
+
+    file_.createDataset<Scalar>("/Extent", {4}, {4}, {4});
+    file_.write("/Extent", extent.data(), {0}, {comm.isMainProc() ? 4ul : 0ul});
+
+    file_.createDataset<Scalar>("/Time", {0}, {H5S_UNLIMITED}, {64});
+    file_.createDataset<Scalar>("/" + field_.lock()->name(), {0, ny_, nx_}, {H5S_UNLIMITED, ny_, nx_}, {1, ny_, nx_});
+}
+
+void ImageSlice::compute(Scalar time, bool force)
+{
+    if (do_update() || force)
+    {
+        const ScalarFiniteVolumeField &field = *field_.lock();
+        const Communicator &comm = field.grid()->comm();
+        std::string path = "/" + field.name();
+
+        file_.extend("/Time", {nSteps_ + 1});
+        file_.write("/Time", &time, {comm.isMainProc() ? nSteps_ : 0}, {comm.isMainProc() ? 1ul : 0ul});
+
+        std::vector<Scalar> values(cellIds_.size());
+
+        for (Label k = 0; k < cellIds_.size(); ++k)
+            values[k] = field[cellIds_[k]];
+
+        file_.extend(path, {nSteps_ + 1, ny_, nx_});
+        file_.write(path, values.data(), values.size(), memIds_, pixels_, {nSteps_}, 2);
+        file_.flush();
+
+        ++nSteps_;
+    }
+}
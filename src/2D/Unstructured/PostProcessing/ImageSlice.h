@@ -0,0 +1,41 @@
+#ifndef PHASE_IMAGE_SLICE_H
+#define PHASE_IMAGE_SLICE_H
+
+#include "System/Hdf5File.h"
+
+#include "PostProcessing.h"
+
+//- Rasterizes a scalar field onto a uniform image of nx by ny pixels covering a box. Each pixel takes the
+//  value of the cell containing its centre, and every process writes the pixels of its owned cells
+//  straight into an extendible (time, y, x) dataset of a shared HDF5 file. Pixels outside the domain
+//  keep the dataset fill value
+class ImageSlice : public PostProcessing::Object
+{
+public:
+
+    ImageSlice(int fileWriteFreq,
+               const std::string &name,
+               const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+               const Point2D &lower,
+               const Point2D &upper,
+               hsize_t nx,
+               hsize_t ny);
+
+    void compute(Scalar time, bool force = false) override;
+
+protected:
+
+    std::weak_ptr<const ScalarFiniteVolumeField> field_;
+
+    hsize_t nx_, ny_, nSteps_;
+
+    Hdf5File file_;
+
+    //- Pixels covered by owned cells, as flat ids y * nx + x, their position in the value buffer and the cells
+    //  covering them
+    std::vector<hsize_t> pixels_, memIds_;
+
+    std::vector<Label> cellIds_;
+};
+
+#endif
@@ -1,14 +1,20 @@
-#include "FiniteVolume/Multiphase/CelesteImmersedBoundary.h"
+#include <sstream>
 
 #include "ImmersedBoundaryObjectContactLineTracker.h"
 
 ImmersedBoundaryObjectContactLineTracker::ImmersedBoundaryObjectContactLineTracker(int fileWriteFreq,
                                                                                    const std::weak_ptr<const ScalarFiniteVolumeField> &gamma,
-                                                                                   const std::weak_ptr<const ImmersedBoundary> &ib)
+                                                                                   const std::weak_ptr<const ImmersedBoundary> &ib,
+                                                                                   const std::weak_ptr<const CelesteImmersedBoundary> &fst,
+                                                                                   Scalar theta,
+                                                                                   int flushFrequency)
     :
       Object(fileWriteFreq),
       gamma_(gamma),
-      ib_(ib)
+      ib_(ib),
+      fst_(fst),
+      theta_(theta),
+      writer_(flushFrequency)
 {
     path_ /= "ImmersedBoundaryObjectContactLineTracker";
 
@@ -17,13 +23,11 @@ ImmersedBoundaryObjectContactLineTracker::ImmersedBoundaryObjectContactLineTrack
 
     for (const auto &ibObj: *ib_.lock())
     {
-        if (gamma_.lock()->grid()->comm().isMainProc())
-        {
-            std::ofstream fout((path_ / (ibObj->name() + "_contact_lines.csv")).string());
-            fout << "time,x,y,rx,ry,beta,nx,ny,theta\n";
-            fout.close();
-        }
+        if (ib_.lock()->isOutputProc(*ibObj))
+            writer_.create((path_ / (ibObj->name() + "_contact_lines.csv")).string(), "time,x,y,rx,ry,beta,nx,ny,theta\n");
     }
+
+    writer_.sync(gamma_.lock()->grid()->comm());
 }
 
 void ImmersedBoundaryObjectContactLineTracker::compute(Scalar time, bool force)
@@ -37,9 +41,14 @@ void ImmersedBoundaryObjectContactLineTracker::compute(Scalar time, bool force)
 
     if (do_update() || force)
     {
-        for (const auto &ibObj: *ib_.lock())
+        const auto &ib = *ib_.lock();
+        auto fst = fst_.lock();
+        std::vector<std::vector<ContactLinePoint>> allClPts(ib.ibObjs().size());
+
+        for (Label i = 0; i < ib.ibObjs().size(); ++i)
         {
-            std::vector<ContactLinePoint> clPts;
+            const auto &ibObj = ib.ibObjs()[i];
+            auto &clPts = allClPts[i];
             clPts.reserve(ibObj->solidCells().size());
 
             const auto &gamma = *gamma_.lock();
@@ -55,15 +64,28 @@ void ImmersedBoundaryObjectContactLineTracker::compute(Scalar time, bool force)
                 if(!computeContactLine)
                     continue;
 
-                auto st = CelesteImmersedBoundary::ContactLineStencil(*ibObj, cell.centroid(), 111. * M_PI / 180., gamma);
-
-                clPts.push_back(ContactLinePoint{st.cl()[1], st.gamma(), st.ncl()});
+                if(fst && fst->theta(*ibObj) == theta_)
+                {
+                    const auto &st = fst->contactLineStencil(*ibObj, cell, gamma);
+                    clPts.push_back(ContactLinePoint{st.cl()[1], st.gamma(), st.ncl()});
+                }
+                else
+                {
+                    auto st = CelesteImmersedBoundary::ContactLineStencil(*ibObj, cell.centroid(), theta_, gamma);
+                    clPts.push_back(ContactLinePoint{st.cl()[1], st.gamma(), st.ncl()});
+                }
             }
+        }
 
-            //- Gather all data to the main proc
-            clPts = gamma_.lock()->grid()->comm().gatherv(gamma_.lock()->grid()->comm().mainProcNo(), clPts);
+        //- Gather all data to the process writing each object
+        allClPts = ib.gather(allClPts);
 
-            if (gamma_.lock()->grid()->comm().isMainProc())
+        for (Label i = 0; i < ib.ibObjs().size(); ++i)
+        {
+            const auto &ibObj = ib.ibObjs()[i];
+            auto &clPts = allClPts[i];
+
+            if (ib.isOutputProc(*ibObj))
             {
                 //- Sort ccw
                 std::sort(clPts.begin(), clPts.end(), [&ibObj](const ContactLinePoint &lhs,
@@ -92,8 +114,7 @@ void ImmersedBoundaryObjectContactLineTracker::compute(Scalar time, bool force)
                     }
                 }
 
-                std::ofstream fout((path_ / (ibObj->name() + "_contact_lines.csv")).string(),
-                                   std::ofstream::out | std::ofstream::app);
+                std::ostringstream fout;
 
                 for (const auto &cl: clLocs)
                 {
@@ -110,8 +131,10 @@ void ImmersedBoundaryObjectContactLineTracker::compute(Scalar time, bool force)
                          << 0. << "\n";
                 }
 
-                fout.close();
+                writer_.append((path_ / (ibObj->name() + "_contact_lines.csv")).string(), fout.str());
             }
         }
+
+        writer_.sync(gamma_.lock()->grid()->comm());
     }
 }
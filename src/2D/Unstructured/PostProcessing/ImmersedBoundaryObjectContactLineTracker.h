@@ -1,8 +1,11 @@
 #ifndef PHASE_IMMERSED_BOUNDARY_OBJECT_CONTACT_LINE_TRACKER_H
 #define PHASE_IMMERSED_BOUNDARY_OBJECT_CONTACT_LINE_TRACKER_H
 
+#include "System/TimeSeriesWriter.h"
+
 #include "FiniteVolume/Field/ScalarFiniteVolumeField.h"
 #include "FiniteVolume/ImmersedBoundary/ImmersedBoundary.h"
+#include "FiniteVolume/Multiphase/CelesteImmersedBoundary.h"
 
 #include "PostProcessing.h"
 
@@ -11,16 +14,30 @@ class ImmersedBoundaryObjectContactLineTracker: public PostProcessing::Object
 public:
     ImmersedBoundaryObjectContactLineTracker(int fileWriteFreq,
                                              const std::weak_ptr<const ScalarFiniteVolumeField> &gamma,
-                                             const std::weak_ptr<const ImmersedBoundary> &ib);
+                                             const std::weak_ptr<const ImmersedBoundary> &ib,
+                                             const std::weak_ptr<const CelesteImmersedBoundary> &fst = std::weak_ptr<const CelesteImmersedBoundary>(),
+                                             Scalar theta = 111. * M_PI / 180.,
+                                             int flushFrequency = 100);
 
     void compute(Scalar time, bool force = false) override;
 
+    void flush() override
+    { writer_.flush(); }
+
 private:
 
     std::weak_ptr<const ImmersedBoundary> ib_;
 
     std::weak_ptr<const ScalarFiniteVolumeField> gamma_;
 
+    //- Shares the solver's cached contact line stencils when available and built with the same contact angle
+    std::weak_ptr<const CelesteImmersedBoundary> fst_;
+
+    //- Contact angle the reported stencils are built with
+    Scalar theta_;
+
+    TimeSeriesWriter writer_;
+
 };
 
 #endif
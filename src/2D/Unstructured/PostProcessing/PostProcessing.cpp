@@ -1,13 +1,19 @@
 #include "PostProcessing.h"
 #include "CgnsViewer.h"
 #include "CompactCgnsViewer.h"
+#include "Hdf5Viewer.h"
+#include "AsyncViewer.h"
 #include "IbTracker.h"
 #include "ImmersedBoundaryObjectProbe.h"
 #include "ImmersedBoundaryObjectContactLineTracker.h"
+#include "VolumeIntegral.h"
+#include "FieldProbes.h"
+#include "ImageSlice.h"
 
 PostProcessing::PostProcessing(const CommandLine &cl, const Input &input, const Solver &solver)
 {
     iter_ = 0;
+    hasHdf5Objects_ = false;
     fileWriteFrequency_ = input.postProcessingInput().get<int>("PostProcessing.fileWriteFrequency");
 
     std::string viewerType = input.postProcessingInput().get<std::string>("PostProcessing.viewerType", "cgns");
@@ -16,8 +22,29 @@ PostProcessing::PostProcessing(const CommandLine &cl, const Input &input, const
         viewer_ = std::unique_ptr<Viewer>(new CgnsViewer(cl, input, solver));
     else if(viewerType == "compactCgns")
         viewer_ = std::unique_ptr<Viewer>(new CompactCgnsViewer(cl, input, solver));
+    else if(viewerType == "hdf5")
+        viewer_ = std::unique_ptr<Viewer>(new Hdf5Viewer(cl, input, solver));
     else
         throw Exception("PostProcessing", "PostProcessing", "Unrecognized viewer type \"" + viewerType + "\".");
+
+    if (input.postProcessingInput().get<bool>("PostProcessing.asyncWrite", false))
+    {
+        if (viewer_->isCollective() && solver.comm().nProcs() > 1 && Communicator::threadSupport() != MPI_THREAD_MULTIPLE)
+            solver.comm().printf("Warning: MPI library does not support MPI_THREAD_MULTIPLE, output will be written synchronously.\n");
+        else
+            viewer_ = std::unique_ptr<Viewer>(
+                        new AsyncViewer(cl, input, solver, std::move(viewer_),
+                                        input.postProcessingInput().get<Size>("PostProcessing.maxQueuedWrites", 2)));
+    }
+}
+
+int PostProcessing::requiredThreadSupport(const Input &input)
+{
+    bool asyncWrite = input.postProcessingInput().get<bool>("PostProcessing.asyncWrite", false);
+    std::string viewerType = input.postProcessingInput().get<std::string>("PostProcessing.viewerType", "cgns");
+
+    //- The HDF5 viewer makes collective MPI-IO calls from the writer thread
+    return asyncWrite && viewerType == "hdf5" ? MPI_THREAD_MULTIPLE : MPI_THREAD_FUNNELED;
 }
 
 void PostProcessing::initIbPostProcessingObjects(const Input &input, const Solver &solver)
@@ -36,7 +63,8 @@ void PostProcessing::initIbPostProcessingObjects(const Input &input, const Solve
         {
             objs_.push_back(
                         std::make_shared<IbTracker>(
-                            objInput.second.get<int>("fileWriteFrequency", fileWriteFrequency_), solver.ib()));
+                            objInput.second.get<int>("fileWriteFrequency", fileWriteFrequency_), solver.ib(),
+                            0.4, "CUST2", inputTree.get<int>("flushFrequency", 100)));
         }
         else if (name == "ImmersedBoundaryObjectProbe")
         {
@@ -54,7 +82,86 @@ void PostProcessing::initIbPostProcessingObjects(const Input &input, const Solve
                         std::make_shared<ImmersedBoundaryObjectContactLineTracker>(
                             objInput.second.get<int>("fileWriteFrequency", fileWriteFrequency_),
                             solver.scalarField(inputTree.get<std::string>("field", "gamma")),
-                            solver.ib()
+                            solver.ib(),
+                            solver.ibSurfaceTension(),
+                            inputTree.get<Scalar>("contactAngle", 111.) * M_PI / 180.,
+                            inputTree.get<int>("flushFrequency", 100)
+                            ));
+        }
+    }
+}
+
+void PostProcessing::initFieldPostProcessingObjects(const Input &input, const Solver &solver)
+{
+    auto objInputs = input.postProcessingInput().get_child_optional("PostProcessing.Objects");
+
+    if(!objInputs)
+        return;
+
+    for (const auto &objInput: objInputs.get())
+    {
+        const std::string &name = objInput.first;
+        const auto &inputTree = objInput.second;
+
+        int fileWriteFrequency = inputTree.get<int>("fileWriteFrequency", fileWriteFrequency_);
+        std::string fieldName = inputTree.get<std::string>("field", "");
+        std::string outputName = inputTree.get<std::string>("name", fieldName);
+
+        if (name == "VolumeIntegral")
+        {
+            //- Integrates over the whole domain unless a box region is given
+            CellGroup cells;
+
+            if (inputTree.get_optional<std::string>("lower"))
+                cells = solver.grid()->localCells().itemsCoveredBy(
+                            Box(Point2D(inputTree.get<std::string>("lower")), Point2D(inputTree.get<std::string>("upper"))));
+            else
+                cells.add(solver.grid()->localCells());
+
+            std::string velocityName = inputTree.get<std::string>("velocity", "u");
+
+            objs_.push_back(
+                        std::make_shared<VolumeIntegral>(
+                            fileWriteFrequency,
+                            outputName,
+                            solver.scalarField(fieldName),
+                            solver.vectorFields().count(velocityName) ? solver.vectorField(velocityName) : nullptr,
+                            cells,
+                            inputTree.get<bool>("complement", false)
+                            ));
+        }
+        else if (name == "FieldProbes" || name == "LineProbe")
+        {
+            std::vector<Point2D> points;
+
+            if (name == "LineProbe")
+                points = FieldProbes::linePoints(Point2D(inputTree.get<std::string>("start")),
+                                                 Point2D(inputTree.get<std::string>("end")),
+                                                 inputTree.get<int>("nPoints"));
+            else
+                for (const auto &point: inputTree.get_child("points"))
+                    points.push_back(Point2D(point.second.get_value<std::string>()));
+
+            if (solver.scalarFields().count(fieldName))
+                objs_.push_back(std::make_shared<FieldProbes>(
+                                    fileWriteFrequency, outputName, solver.scalarField(fieldName), points));
+            else
+                objs_.push_back(std::make_shared<FieldProbes>(
+                                    fileWriteFrequency, outputName, solver.vectorField(fieldName), points));
+        }
+        else if (name == "ImageSlice")
+        {
+            hasHdf5Objects_ = true;
+
+            objs_.push_back(
+                        std::make_shared<ImageSlice>(
+                            fileWriteFrequency,
+                            outputName,
+                            solver.scalarField(fieldName),
+                            Point2D(inputTree.get<std::string>("lower")),
+                            Point2D(inputTree.get<std::string>("upper")),
+                            inputTree.get<hsize_t>("nx"),
+                            inputTree.get<hsize_t>("ny")
                             ));
         }
     }
@@ -62,8 +169,18 @@ void PostProcessing::initIbPostProcessingObjects(const Input &input, const Solve
 
 void PostProcessing::compute(Scalar time, bool force)
 {
+    //- HDF5 is not thread-safe, the previous asynchronous write must complete first
+    if (hasHdf5Objects_)
+        viewer_->flush();
+
     PostProcessingInterface::compute(time, force);
 
     if (iter_++ % fileWriteFrequency_ == 0 || force)
         viewer_->write(time);
 }
+
+void PostProcessing::flush()
+{
+    PostProcessingInterface::flush();
+    viewer_->flush();
+}
@@ -15,14 +15,25 @@ public:
 
     PostProcessing(const CommandLine& cl, const Input& input, const Solver& solver);
 
+    //- MPI thread level needed by the configured viewer, MPI_THREAD_MULTIPLE only for asynchronous collective writes
+    static int requiredThreadSupport(const Input &input);
+
     void initIbPostProcessingObjects(const Input &input, const Solver &solver);
 
+    //- Integrals, probes and image slices of the solver fields
+    void initFieldPostProcessingObjects(const Input &input, const Solver &solver);
+
     void compute(Scalar time, bool force = false) override;
 
+    void flush() override;
+
 protected:
 
     int iter_, fileWriteFrequency_;
 
+    //- Objects writing HDF5 files from the solver thread must not overlap an asynchronous viewer write
+    bool hasHdf5Objects_;
+
     std::unique_ptr<Viewer> viewer_;
 };
 
@@ -20,3 +20,59 @@ Viewer::Viewer(const CommandLine &cl, const Input &input, const Solver &solver)
     split(scalarFields_, scalarFields, is_any_of(", "), token_compress_on);
     split(vectorFields_, vectorFields, is_any_of(", "), token_compress_on);
 }
+
+void Viewer::write(Scalar solutionTime)
+{
+    Snapshot snapshot;
+    takeSnapshot(solutionTime, snapshot, false);
+    writeSnapshot(snapshot);
+}
+
+template<class T, class TFieldGetter>
+static void stageFields(const std::unordered_set<std::string> &names,
+                        const TFieldGetter &getField,
+                        bool copy,
+                        std::vector<Viewer::FieldData<T>> &staged)
+{
+    Label n = 0;
+
+    for (const std::string &name: names)
+    {
+        auto field = getField(name);
+
+        if (!field)
+            continue;
+
+        if (n == staged.size())
+            staged.emplace_back();
+
+        Viewer::FieldData<T> &entry = staged[n++];
+
+        entry.name = field->name();
+        entry.size = field->size();
+
+        if (copy)
+        {
+            entry.storage.assign(field->begin(), field->end());
+            entry.data = entry.storage.data();
+        }
+        else
+            entry.data = field->data();
+    }
+
+    staged.resize(n);
+}
+
+void Viewer::takeSnapshot(Scalar solutionTime, Snapshot &snapshot, bool copy) const
+{
+    snapshot.time = solutionTime;
+
+    stageFields(integerFields_, [this](const std::string &name) { return solver_.integerField(name); },
+                copy, snapshot.integerFields);
+
+    stageFields(scalarFields_, [this](const std::string &name) { return solver_.scalarField(name); },
+                copy, snapshot.scalarFields);
+
+    stageFields(vectorFields_, [this](const std::string &name) { return solver_.vectorField(name); },
+                copy, snapshot.vectorFields);
+}
@@ -10,9 +10,50 @@ class Viewer
 {
 public:
 
+    //- Cell values of one output field. Data points into the field itself, or into storage when the
+    //  values have to outlive the current time step
+    template<class T>
+    struct FieldData
+    {
+        std::string name;
+
+        const T *data;
+
+        Size size;
+
+        std::vector<T> storage;
+    };
+
+    struct Snapshot
+    {
+        Scalar time;
+
+        std::vector<FieldData<int>> integerFields;
+
+        std::vector<FieldData<Scalar>> scalarFields;
+
+        std::vector<FieldData<Vector2D>> vectorFields;
+    };
+
     Viewer(const CommandLine &cl, const Input& input, const Solver& solver);
 
-    virtual void write(Scalar solutionTime) = 0;
+    virtual ~Viewer() = default;
+
+    virtual void write(Scalar solutionTime);
+
+    virtual void writeSnapshot(const Snapshot &snapshot) = 0;
+
+    //- Without copy the snapshot refers to the live fields and is only valid until they change. A copy
+    //  reuses the storage already held by the snapshot
+    void takeSnapshot(Scalar solutionTime, Snapshot &snapshot, bool copy) const;
+
+    //- Blocks until all pending writes are complete
+    virtual void flush()
+    {}
+
+    //- Whether writes communicate between processes
+    virtual bool isCollective() const
+    { return false; }
 
 protected:
 
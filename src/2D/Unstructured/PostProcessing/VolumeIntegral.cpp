@@ -0,0 +1,70 @@
+#include "VolumeIntegral.h"
+
+VolumeIntegral::VolumeIntegral(int fileWriteFreq,
+                               const std::string &name,
+                               const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+                               const std::weak_ptr<const VectorFiniteVolumeField> &u,
+                               const CellGroup &cells,
+                               bool complement)
+    :
+      Object(fileWriteFreq),
+      name_(name),
+      field_(field),
+      u_(u),
+      cells_(cells),
+      complement_(complement)
+{
+    path_ /= "VolumeIntegrals";
+
+    if (field_.lock()->grid()->comm().isMainProc())
+    {
+        createOutputDirectory();
+
+        std::ofstream fout(getFilename());
+        fout << "time,volume,xc,yc,ux,uy\n";
+        fout.close();
+    }
+}
+
+void VolumeIntegral::compute(Scalar time, bool force)
+{
+    if (do_update() || force)
+    {
+        const ScalarFiniteVolumeField &field = *field_.lock();
+        auto u = u_.lock();
+        const Communicator &comm = field.grid()->comm();
+
+        Scalar volume = 0.;
+        Vector2D moment(0., 0.), momentum(0., 0.);
+
+        for (const Cell &cell: cells_)
+        {
+            Scalar dV = (complement_ ? 1. - field(cell) : field(cell)) * cell.volume();
+
+            volume += dV;
+            moment += dV * cell.centroid();
+
+            if (u)
+                momentum += dV * (*u)(cell);
+        }
+
+        volume = comm.sum(volume);
+        moment = Vector2D(comm.sum(moment.x), comm.sum(moment.y));
+        momentum = Vector2D(comm.sum(momentum.x), comm.sum(momentum.y));
+
+        if (comm.isMainProc())
+        {
+            Vector2D xc = volume > 0. ? moment / volume : Vector2D(0., 0.);
+            Vector2D uc = volume > 0. ? momentum / volume : Vector2D(0., 0.);
+
+            std::ofstream fout(getFilename(), std::ofstream::app);
+            fout << time << "," << volume << "," << xc.x << "," << xc.y << "," << uc.x << "," << uc.y << "\n";
+            fout.close();
+        }
+    }
+}
+
+std::string VolumeIntegral::getFilename() const
+{
+    return (path_ / (name_ + ".csv")).string();
+}
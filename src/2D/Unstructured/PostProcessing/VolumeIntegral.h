@@ -0,0 +1,37 @@
+#ifndef PHASE_VOLUME_INTEGRAL_H
+#define PHASE_VOLUME_INTEGRAL_H
+
+#include "PostProcessing.h"
+
+//- Integral of a phase indicator over a group of cells, along with the centroid and mean velocity of the
+//  phase it marks. Sums are taken over owned cells and reduced across processes
+class VolumeIntegral : public PostProcessing::Object
+{
+public:
+
+    VolumeIntegral(int fileWriteFreq,
+                   const std::string &name,
+                   const std::weak_ptr<const ScalarFiniteVolumeField> &field,
+                   const std::weak_ptr<const VectorFiniteVolumeField> &u,
+                   const CellGroup &cells,
+                   bool complement = false);
+
+    void compute(Scalar time, bool force = false) override;
+
+protected:
+
+    std::string getFilename() const;
+
+    std::string name_;
+
+    std::weak_ptr<const ScalarFiniteVolumeField> field_;
+
+    std::weak_ptr<const VectorFiniteVolumeField> u_;
+
+    CellGroup cells_;
+
+    //- Integrates 1 - field, eg for the gas phase when the field is the liquid fraction
+    bool complement_;
+};
+
+#endif
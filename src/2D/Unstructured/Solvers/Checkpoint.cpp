@@ -0,0 +1,362 @@
+#include <numeric>
+#include <algorithm>
+#include <cstring>
+
+#include <boost/filesystem.hpp>
+
+#include "System/Exception.h"
+
+#include "Solver.h"
+#include "Checkpoint.h"
+
+//- Field values as native components, vectors are stored as pairs of scalars
+template<class T>
+struct Components
+{
+    typedef T Type;
+
+    static const hsize_t n = 1;
+};
+
+template<>
+struct Components<Vector2D>
+{
+    typedef Scalar Type;
+
+    static const hsize_t n = 2;
+};
+
+template<class T>
+static std::vector<std::string> sortedNames(const std::unordered_map<std::string, T> &fields)
+{
+    //- Datasets are created collectively, so every process must visit the fields in the same order
+    std::vector<std::string> names;
+
+    for (const auto &entry: fields)
+        names.push_back(entry.first);
+
+    std::sort(names.begin(), names.end());
+
+    return names;
+}
+
+static void hashBytes(unsigned long &hash, const void *data, Size size)
+{
+    //- 64 bit FNV-1a
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+    for (Size i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ul;
+    }
+}
+
+Checkpoint::Checkpoint(const Input &input, Solver &solver)
+    :
+      solver_(solver),
+      count_(0)
+{
+    path_ = input.caseInput().get<std::string>("Checkpoint.path", "./checkpoint");
+    casename_ = input.caseInput().get<std::string>("CaseName");
+    nSlots_ = std::max(input.caseInput().get<int>("Checkpoint.nSlots", 2), 1);
+}
+
+void Checkpoint::write(Scalar time, Scalar timeStep)
+{
+    const Communicator &comm = solver_.comm();
+    std::string filename = slotFilename(count_ % nSlots_);
+
+    if (comm.isMainProc())
+        boost::filesystem::create_directories(path_);
+
+    comm.barrier();
+
+    solver_.printf("Writing checkpoint to \"%s\"...\n", filename.c_str());
+
+    Hdf5File file(filename, Hdf5File::WRITE, comm);
+
+    //- Run state, held by every process and written by the main process
+    hsize_t nMain = comm.isMainProc() ? 1 : 0;
+
+    file.createGroup("/Info");
+    writeBlock(file, "/Info/Time", &time, nMain, 1);
+    writeBlock(file, "/Info/TimeStep", &timeStep, nMain, 1);
+    writeBlock(file, "/Info/Count", &count_, nMain, 1);
+
+    std::vector<unsigned long> gridFingerprint = fingerprint();
+
+    file.createGroup("/Grid");
+    writeBlock(file, "/Grid/Fingerprint", gridFingerprint.data(), 1, gridFingerprint.size());
+
+    file.createGroup("/Fields");
+    file.createGroup("/Fields/Integer");
+    file.createGroup("/Fields/Scalar");
+    file.createGroup("/Fields/Vector");
+
+    for (const std::string &name: sortedNames(solver_.integerFields()))
+        writeField(file, "/Fields/Integer/" + name, *solver_.integerFields().find(name)->second);
+
+    for (const std::string &name: sortedNames(solver_.scalarFields()))
+        writeField(file, "/Fields/Scalar/" + name, *solver_.scalarFields().find(name)->second);
+
+    for (const std::string &name: sortedNames(solver_.vectorFields()))
+        writeField(file, "/Fields/Vector/" + name, *solver_.vectorFields().find(name)->second);
+
+    //- Object states are plain structures and are stored as raw bytes
+    if (solver_.ib())
+    {
+        std::vector<ImmersedBoundary::IbObjectState> states = solver_.ib()->checkpointStates();
+
+        file.createGroup("/ImmersedBoundary");
+        writeBlock(file, "/ImmersedBoundary/States", reinterpret_cast<const char *>(states.data()),
+                   states.size(), sizeof(ImmersedBoundary::IbObjectState));
+    }
+
+    //- The marker is written last, a slot without it holds an incomplete checkpoint
+    file.flush();
+
+    int complete = 1;
+    writeBlock(file, "/Info/Complete", &complete, nMain, 1);
+
+    file.close();
+
+    ++count_;
+}
+
+bool Checkpoint::read(Scalar &time, Scalar &timeStep)
+{
+    const Communicator &comm = solver_.comm();
+
+    unsigned long count;
+    int slot = newestSlot(count);
+
+    if (slot < 0)
+        return false;
+
+    std::string filename = slotFilename(slot);
+    Hdf5File file(filename, Hdf5File::READ, comm);
+
+    //- The checkpoint must come from the same decomposition of the same grid
+    std::vector<unsigned long> gridFingerprint = fingerprint(), storedFingerprint(gridFingerprint.size());
+    bool isMatch = file.dims("/Grid/Fingerprint")[0] == comm.nProcs();
+
+    if (isMatch)
+    {
+        readBlock(file, "/Grid/Fingerprint", storedFingerprint.data(), 1, storedFingerprint.size());
+        isMatch = storedFingerprint == gridFingerprint;
+    }
+
+    if (comm.sum((unsigned long) !isMatch) > 0)
+        throw Exception("Checkpoint", "read", "checkpoint \"" + filename
+                        + "\" was written for a different grid or number of processes.");
+
+    time = file.read<Scalar>("/Info/Time")[0];
+    timeStep = file.read<Scalar>("/Info/TimeStep")[0];
+
+    for (const std::string &name: sortedNames(solver_.integerFields()))
+        readField(file, "/Fields/Integer/" + name, *solver_.integerFields().find(name)->second);
+
+    for (const std::string &name: sortedNames(solver_.scalarFields()))
+        readField(file, "/Fields/Scalar/" + name, *solver_.scalarFields().find(name)->second);
+
+    for (const std::string &name: sortedNames(solver_.vectorFields()))
+        readField(file, "/Fields/Vector/" + name, *solver_.vectorFields().find(name)->second);
+
+    if (solver_.ib() && file.exists("/ImmersedBoundary/States"))
+    {
+        std::vector<char> bytes = file.read<char>("/ImmersedBoundary/States");
+        std::vector<ImmersedBoundary::IbObjectState> states(bytes.size() / sizeof(ImmersedBoundary::IbObjectState));
+
+        std::memcpy(states.data(), bytes.data(), bytes.size());
+
+        //- The solver only hands out const access, the immersed boundary itself is not const
+        std::const_pointer_cast<ImmersedBoundary>(solver_.ib())->restoreStates(states);
+    }
+
+    file.close();
+
+    count_ = count + 1;
+
+    solver_.printf("Restarted from checkpoint \"%s\" at t = %lf.\n", filename.c_str(), time);
+
+    return true;
+}
+
+bool Checkpoint::exists() const
+{
+    unsigned long count;
+    return newestSlot(count) >= 0;
+}
+
+//- Protected
+
+std::string Checkpoint::slotFilename(int slot) const
+{
+    return (boost::filesystem::path(path_) / (casename_ + "." + std::to_string(slot) + ".h5")).string();
+}
+
+int Checkpoint::newestSlot(unsigned long &count) const
+{
+    int newest = -1;
+
+    for (int slot = 0; slot < nSlots_; ++slot)
+    {
+        if (!boost::filesystem::exists(slotFilename(slot)))
+            continue;
+
+        Hdf5File file(slotFilename(slot), Hdf5File::READ, solver_.comm());
+
+        if (!file.exists("/Info/Complete"))
+            continue;
+
+        unsigned long slotCount = file.read<unsigned long>("/Info/Count")[0];
+
+        if (newest < 0 || slotCount > count)
+        {
+            newest = slot;
+            count = slotCount;
+        }
+    }
+
+    return newest;
+}
+
+std::vector<unsigned long> Checkpoint::fingerprint() const
+{
+    const FiniteVolumeGrid2D &grid = *solver_.grid();
+    unsigned long hash = 14695981039346656037ul;
+
+    hashBytes(hash, grid.globalIds().data(), grid.globalIds().size() * sizeof(Label));
+
+    for (const Node &node: grid.nodes())
+    {
+        hashBytes(hash, &node.x, sizeof(Scalar));
+        hashBytes(hash, &node.y, sizeof(Scalar));
+    }
+
+    return {grid.nCells(), grid.nFaces(), grid.nNodes(), hash};
+}
+
+template<class T>
+void Checkpoint::writeField(Hdf5File &file, const std::string &path, const FiniteVolumeField<T> &field) const
+{
+    file.createGroup(path);
+    writeValues(file, path, field);
+
+    //- History levels, newest first
+    std::vector<Scalar> timeSteps;
+
+    for (int i = 0; i < field.nOldFields(); ++i)
+    {
+        std::string levelPath = path + "/Old" + std::to_string(i);
+
+        timeSteps.push_back(field.oldTimeStep(i));
+        file.createGroup(levelPath);
+        writeValues(file, levelPath, field.oldField(i));
+    }
+
+    writeBlock(file, path + "/TimeSteps", timeSteps.data(), solver_.comm().isMainProc() ? timeSteps.size() : 0, 1);
+}
+
+template<class T>
+void Checkpoint::readField(const Hdf5File &file, const std::string &path, FiniteVolumeField<T> &field) const
+{
+    //- Fields added since the checkpoint was written keep their initial values
+    if (!file.exists(path))
+        return;
+
+    readValues(file, path, field);
+    field.clearHistory();
+
+    if (!file.exists(path + "/TimeSteps"))
+        return;
+
+    //- Levels are added from the oldest, each new level becomes the newest
+    std::vector<Scalar> timeSteps = file.read<Scalar>(path + "/TimeSteps");
+
+    for (int i = timeSteps.size() - 1; i >= 0; --i)
+    {
+        field.savePreviousTimeStep(timeSteps[i], timeSteps.size());
+        readValues(file, path + "/Old" + std::to_string(i), field.oldField(0));
+    }
+}
+
+template<class T>
+void Checkpoint::writeValues(Hdf5File &file, const std::string &path, const FiniteVolumeField<T> &field) const
+{
+    typedef typename Components<T>::Type Type;
+    hsize_t nc = Components<T>::n;
+
+    writeBlock(file, path + "/Cells", reinterpret_cast<const Type *>(field.data()), field.size(), nc);
+
+    if (field.hasFaces())
+        writeBlock(file, path + "/Faces", reinterpret_cast<const Type *>(field.faces().data()), field.faces().size(), nc);
+
+    if (field.hasNodes())
+        writeBlock(file, path + "/Nodes", reinterpret_cast<const Type *>(field.nodes().data()), field.nodes().size(), nc);
+}
+
+template<class T>
+void Checkpoint::readValues(const Hdf5File &file, const std::string &path, FiniteVolumeField<T> &field) const
+{
+    typedef typename Components<T>::Type Type;
+    hsize_t nc = Components<T>::n;
+
+    readBlock(file, path + "/Cells", reinterpret_cast<Type *>(field.data()), field.size(), nc);
+
+    if (field.hasFaces())
+        readBlock(file, path + "/Faces", reinterpret_cast<Type *>(field.faces().data()), field.faces().size(), nc);
+
+    if (field.hasNodes())
+        readBlock(file, path + "/Nodes", reinterpret_cast<Type *>(field.nodes().data()), field.nodes().size(), nc);
+}
+
+template<class T>
+void Checkpoint::writeBlock(Hdf5File &file, const std::string &path, const T *data, hsize_t size, hsize_t nComponents) const
+{
+    const Communicator &comm = solver_.comm();
+
+    std::vector<unsigned long> sizes = comm.allGather((unsigned long) size);
+    hsize_t offset = std::accumulate(sizes.begin(), sizes.begin() + comm.rank(), 0ul);
+    hsize_t nTotal = std::accumulate(sizes.begin(), sizes.end(), 0ul);
+
+    //- Empty datasets are not created
+    if (nTotal == 0)
+        return;
+
+    std::vector<hsize_t> dims = {nTotal}, offsets = {offset}, count = {size}, chunk = {std::min(nTotal, hsize_t(65536))};
+
+    if (nComponents > 1)
+    {
+        dims.push_back(nComponents);
+        offsets.push_back(0);
+        count.push_back(nComponents);
+        chunk.push_back(nComponents);
+    }
+
+    file.createDataset<T>(path, dims, dims, chunk);
+    file.write(path, data, offsets, count);
+}
+
+template<class T>
+void Checkpoint::readBlock(const Hdf5File &file, const std::string &path, T *data, hsize_t size, hsize_t nComponents) const
+{
+    const Communicator &comm = solver_.comm();
+
+    std::vector<unsigned long> sizes = comm.allGather((unsigned long) size);
+    hsize_t offset = std::accumulate(sizes.begin(), sizes.begin() + comm.rank(), 0ul);
+
+    if (!file.exists(path))
+        return;
+
+    std::vector<hsize_t> offsets = {offset}, count = {size};
+
+    if (nComponents > 1)
+    {
+        offsets.push_back(0);
+        count.push_back(nComponents);
+    }
+
+    file.read(path, data, offsets, count);
+}
@@ -0,0 +1,68 @@
+#ifndef PHASE_CHECKPOINT_H
+#define PHASE_CHECKPOINT_H
+
+#include "System/Input.h"
+#include "System/Hdf5File.h"
+
+#include "FiniteVolume/Field/FiniteVolumeField.h"
+
+class Solver;
+
+//- Complete solver state for restarting, kept apart from the visualization output. Each checkpoint is one
+//  HDF5 file shared by all processes, written in rotating slots so a failed write leaves the previous
+//  checkpoint intact. Every process holds a contiguous block of each dataset, so a restart on the same
+//  decomposition only reads local data
+class Checkpoint
+{
+public:
+
+    Checkpoint(const Input &input, Solver &solver);
+
+    //- Writes into the oldest slot, timeStep is the step the run continues with
+    void write(Scalar time, Scalar timeStep);
+
+    //- Restores the newest complete checkpoint, returns false if there is none
+    bool read(Scalar &time, Scalar &timeStep);
+
+    bool exists() const;
+
+protected:
+
+    std::string slotFilename(int slot) const;
+
+    //- Slot holding the newest complete checkpoint, -1 if there is none
+    int newestSlot(unsigned long &count) const;
+
+    //- Local grid sizes and a hash of its global cell ids and node coordinates
+    std::vector<unsigned long> fingerprint() const;
+
+    template<class T>
+    void writeField(Hdf5File &file, const std::string &path, const FiniteVolumeField<T> &field) const;
+
+    template<class T>
+    void readField(const Hdf5File &file, const std::string &path, FiniteVolumeField<T> &field) const;
+
+    template<class T>
+    void writeValues(Hdf5File &file, const std::string &path, const FiniteVolumeField<T> &field) const;
+
+    template<class T>
+    void readValues(const Hdf5File &file, const std::string &path, FiniteVolumeField<T> &field) const;
+
+    //- Per-process blocks of nComponents values per entry
+    template<class T>
+    void writeBlock(Hdf5File &file, const std::string &path, const T *data, hsize_t size, hsize_t nComponents) const;
+
+    template<class T>
+    void readBlock(const Hdf5File &file, const std::string &path, T *data, hsize_t size, hsize_t nComponents) const;
+
+    Solver &solver_;
+
+    std::string path_, casename_;
+
+    int nSlots_;
+
+    //- Number of checkpoints written by this run and the runs it continues
+    unsigned long count_;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "FiniteVolume/Discretization/Divergence.h"
 #include "FiniteVolume/Discretization/Laplacian.h"
 #include "FiniteVolume/Discretization/Source.h"
+#include "FiniteVolume/Discretization/Courant.h"
 
 #include "FractionalStep.h"
 
@@ -50,22 +51,12 @@ Scalar FractionalStep::solve(Scalar timeStep)
 
 Scalar FractionalStep::maxCourantNumber(Scalar timeStep) const
 {
+    fv::courantNumber(u_, timeStep, co_);
+
     Scalar maxCo = 0;
 
     for (const Cell &cell: *fluid_)
-    {
-        Scalar co = 0.;
-
-        for (const InteriorLink &nb: cell.neighbours())
-            co += std::max(dot(u_(nb.face()), nb.outwardNorm()), 0.);
-
-        for (const BoundaryLink &bd: cell.boundaries())
-            co += std::max(dot(u_(bd.face()), bd.outwardNorm()), 0.);
-
-        co *= timeStep / cell.volume();
-        co_(cell) = co;
-        maxCo = std::max(co, maxCo);
-    }
+        maxCo = std::max(co_(cell), maxCo);
 
     return grid_->comm().max(maxCo);
 }
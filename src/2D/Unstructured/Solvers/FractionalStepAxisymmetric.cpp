@@ -4,6 +4,7 @@
 #include "FiniteVolume/Discretization/AxisymmetricLaplacian.h"
 #include "FiniteVolume/Discretization/AxisymmetricStressTensor.h"
 #include "FiniteVolume/Discretization/AxisymmetricSource.h"
+#include "FiniteVolume/Discretization/AxisymmetricCourant.h"
 
 #include "FractionalStepAxisymmetric.h"
 
@@ -16,24 +17,12 @@ FractionalStepAxisymmetric::FractionalStepAxisymmetric(const Input &input, const
 
 Scalar FractionalStepAxisymmetric::maxCourantNumber(Scalar timeStep) const
 {
+    axi::courantNumber(u_, timeStep, co_);
+
     Scalar maxCo = 0;
 
     for (const Cell &cell: *fluid_)
-    {
-        Scalar co = 0.;
-
-        for (const InteriorLink &nb: cell.neighbours())
-            co += std::max(dot(u_(nb.face()), nb.polarOutwardNorm()), 0.);
-
-        for (const BoundaryLink &bd: cell.boundaries())
-            co += std::max(dot(u_(bd.face()), bd.polarOutwardNorm()), 0.);
-
-        co *= timeStep / cell.polarVolume();
-        co_(cell) = co;
-        maxCo = std::max(co, maxCo);
-    }
-
-    co_.sendMessages();
+        maxCo = std::max(co_(cell), maxCo);
 
     return grid_->comm().max(maxCo);
 }
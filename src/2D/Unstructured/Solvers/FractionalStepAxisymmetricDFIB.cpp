@@ -19,6 +19,10 @@ FractionalStepAxisymmetricDFIB::FractionalStepAxisymmetricDFIB(const Input &inpu
     ib_ = std::make_shared<DirectForcingImmersedBoundary>(input, grid, fluid_);
     addField<int>(ib_->cellStatus());
 
+    if(ib_->isDistributed())
+        throw Exception("FractionalStepAxisymmetricDFIB", "FractionalStepAxisymmetricDFIB",
+                        "distributed immersed boundaries are not supported for axisymmetric cases.");
+
     for(auto &ibObj: *ib_)
     {
         auto motion = std::dynamic_pointer_cast<SolidBodyMotion>(ibObj->motion());
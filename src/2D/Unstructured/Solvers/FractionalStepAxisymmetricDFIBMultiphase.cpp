@@ -6,6 +6,7 @@
 #include "FiniteVolume/Discretization/AxisymmetricSource.h"
 #include "FiniteVolume/Discretization/AxisymmetricStressTensor.h"
 #include "FiniteVolume/Discretization/AxisymmetricCicsam.h"
+#include "FiniteVolume/Discretization/AxisymmetricCourant.h"
 #include "FiniteVolume/ImmersedBoundary/DirectForcingImmersedBoundary.h"
 
 #include "FractionalStepAxisymmetricDFIBMultiphase.h"
@@ -78,7 +79,9 @@ Scalar FractionalStepAxisymmetricDFIBMultiphase::solve(Scalar timeStep)
 
 Scalar FractionalStepAxisymmetricDFIBMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = axi::cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
+    //- Cell Courant numbers are computed once and shared with the face weighting
+    axi::courantNumber(u_, timeStep, co_);
+    auto beta = axi::cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, co_);
 
     gamma_.savePreviousTimeStep(timeStep, 1.);
     gammaEqn_ = (axi::ddt(gamma_, timeStep) + axi::cicsam::div(u_, gamma_, beta, 0.) == 0.);
@@ -106,7 +109,7 @@ Scalar FractionalStepAxisymmetricDFIBMultiphase::solveGammaEqn(Scalar timeStep)
 void FractionalStepAxisymmetricDFIBMultiphase::updateProperties(Scalar timeStep)
 {
     //- Update rho and mu
-    rho_.savePreviousTimeStep(timeStep, 1);
+    rho_.rotatePreviousTimeStep(timeStep, 1);
     rho_.computeCells([this](const Cell &c) {
         return rho1_ + clamp(gamma_(c), 0., 1.) * (rho2_ - rho1_);
     });
@@ -115,7 +118,7 @@ void FractionalStepAxisymmetricDFIBMultiphase::updateProperties(Scalar timeStep)
         return rho1_ + clamp(gamma_(f), 0., 1.) * (rho2_ - rho1_);
     });
 
-    mu_.savePreviousTimeStep(timeStep, 1);
+    mu_.rotatePreviousTimeStep(timeStep, 1);
     mu_.computeCells([this](const Cell &c) {
         return rho_(c) / (rho1_ / mu1_ + clamp(gamma_(c), 0., 1.) * (rho2_ / mu2_ - rho1_ / mu1_));
     });
@@ -127,7 +130,7 @@ void FractionalStepAxisymmetricDFIBMultiphase::updateProperties(Scalar timeStep)
     //- Update the gravitational source term
     gradRho_.computeFaces();
 
-    sg_.savePreviousTimeStep(timeStep, 1);
+    sg_.rotatePreviousTimeStep(timeStep, 1);
     sg_.computeFaces([this](const Face &face) {
         return dot(g_, -face.centroid()) * gradRho_(face);
     });
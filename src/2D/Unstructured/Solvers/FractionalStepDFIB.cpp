@@ -95,19 +95,20 @@ void FractionalStepDFIB::solveExtEqns()
 
 void FractionalStepDFIB::computIbForce(Scalar timeStep)
 {
-    for(auto &ibObj: *ib_)
+    std::vector<Vector2D> fh(ib_->ibObjs().size(), Vector2D(0., 0.));
+
+    for(Label i = 0; i < ib_->ibObjs().size(); ++i)
     {
         //- Compute the hydro force from the ib force
-        Vector2D fh(0., 0.);
-        for(const Cell &c: ibObj->cells())
+        for(const Cell &c: ib_->ibObjs()[i]->cells())
         {
-            fh += (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
+            fh[i] += (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
 
             for(const InteriorLink &nb: c.neighbours())
             {
                 Scalar flux0 = dot(u_.oldField(0)(nb.face()), nb.outwardNorm()) / 2.;
                 Scalar flux1 = dot(u_.oldField(1)(nb.face()), nb.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
+                fh[i] += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
                         + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(nb.cell());
             }
 
@@ -115,23 +116,31 @@ void FractionalStepDFIB::computIbForce(Scalar timeStep)
             {
                 Scalar flux0 = dot(u_.oldField(0)(bd.face()), bd.outwardNorm()) / 2.;
                 Scalar flux1 = dot(u_.oldField(1)(bd.face()), bd.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
+                fh[i] += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
                         + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(bd.face());
             }
 
-            fh -= (fb_(c) + g_) * c.volume();
+            fh[i] -= (fb_(c) + g_) * c.volume();
         }
+    }
+
+    //- One reduction for all objects
+    fh = ib_->sum(fh);
+
+    for(Label i = 0; i < ib_->ibObjs().size(); ++i)
+    {
+        auto &ibObj = ib_->ibObjs()[i];
 
-        fh = grid_->comm().sum(rho_ * fh);
+        fh[i] *= rho_;
 
         Vector2D fw = ibObj->rho * ibObj->shape().area() * g_;
 
-        if(grid_->comm().isMainProc())
-            std::cout << "Hydrodynamic force = " << fh << "\n"
+        if(grid_->comm().isMainProc() && ibObj->isReplicated())
+            std::cout << "Hydrodynamic force = " << fh[i] << "\n"
                       << "Weight = " << fw << "\n"
-                      << "Net = " << fh + fw << "\n";
+                      << "Net = " << fh[i] + fw << "\n";
 
 
-        ibObj->applyForce(fh + fw);
+        ibObj->applyForce(fh[i] + fw);
     }
 }
@@ -8,6 +8,8 @@
 #include "FiniteVolume/Discretization/Laplacian.h"
 #include "FiniteVolume/Discretization/Source.h"
 #include "FiniteVolume/Discretization/Cicsam.h"
+#include "FiniteVolume/Discretization/Courant.h"
+#include "FiniteVolume/Discretization/Plic.h"
 
 #include "FractionalStepDFIBMultiphase.h"
 
@@ -29,6 +31,22 @@ FractionalStepDirectForcingMultiphase::FractionalStepDirectForcingMultiphase(con
     mu1_ = input.caseInput().get<Scalar>("Properties.mu1", FractionalStep::mu_);
     mu2_ = input.caseInput().get<Scalar>("Properties.mu2", FractionalStep::mu_);
 
+    std::string gammaScheme = input.caseInput().get<std::string>("Solver.gammaScheme", "cicsam");
+
+    if (gammaScheme == "cicsam")
+        gammaScheme_ = CICSAM;
+    else if (gammaScheme == "plic")
+        gammaScheme_ = PLIC;
+    else
+        throw Exception("FractionalStepDirectForcingMultiphase",
+                        "FractionalStepDirectForcingMultiphase",
+                        "unrecognized gamma scheme \"" + gammaScheme + "\".");
+
+    subCycleGamma_ = input.caseInput().get<bool>("Solver.subCycleGamma", false);
+    maxGammaSubCycles_ = input.caseInput().get<int>("Solver.maxGammaSubCycles", 10);
+    maxInterfaceCo_ = input.caseInput().get<Scalar>("Solver.maxInterfaceCo", 0.3);
+    maxGammaCo_ = input.caseInput().get<Scalar>("Solver.maxGammaCo", 1.);
+
     capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
     for (const Face &face: grid_->interiorFaces())
     {
@@ -94,13 +112,60 @@ Scalar FractionalStepDirectForcingMultiphase::solve(Scalar timeStep)
     return 0;
 }
 
+Scalar FractionalStepDirectForcingMultiphase::computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const
+{
+    //- With gamma sub-cycling the flow step is only bounded by the flow Courant number and the capillary limit
+    Scalar maxTimeStep = FractionalStepDFIB::computeMaxTimeStep(maxCo, prevTimeStep);
+    return subCycleGamma_ ? std::min(maxTimeStep, capillaryTimeStep_) : maxTimeStep;
+}
+
 Scalar FractionalStepDirectForcingMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
+    int nSubCycles = subCycleGamma_ && u_.nOldFields() > 0 ? nGammaSubCycles(timeStep) : 1;
+
+    if (nSubCycles == 1)
+        return gammaScheme_ == PLIC ? solveGammaEqnPlic(u_, timeStep) : solveGammaEqnCicsam(u_, timeStep);
+
+    grid_->comm().printf("Gamma sub-cycles = %d\n", nSubCycles);
+
+    //- Velocities are extrapolated linearly from the last two time levels to each sub-step midpoint. Cell values
+    //  are needed as well as faces, PLIC traces the interface nodes with the surrounding cell velocities
+    const VectorFiniteVolumeField &u0 = u_.oldField(0);
+    VectorFiniteVolumeField uSub(grid_, "uSub", Vector2D(0., 0.), true, false, fluid_);
+
+    Scalar subTimeStep = timeStep / nSubCycles;
+    Scalar error = 0.;
+
+    for (int i = 0; i < nSubCycles; ++i)
+    {
+        Scalar s = (i + 0.5) * subTimeStep / u_.oldTimeStep(0);
+
+        for (const Face &face: grid_->faces())
+            uSub(face) = (1. + s) * u_(face) - s * u0(face);
+
+        for (const Cell &cell: grid_->localCells())
+            uSub(cell) = (1. + s) * u_(cell) - s * u0(cell);
+
+        uSub.sendMessages();
+
+        error = gammaScheme_ == PLIC ? solveGammaEqnPlic(uSub, subTimeStep) : solveGammaEqnCicsam(uSub, subTimeStep);
+    }
+
+    //- Leave the Courant numbers consistent with the full step
+    fv::courantNumber(u_, timeStep, co_);
+
+    return error;
+}
+
+Scalar FractionalStepDirectForcingMultiphase::solveGammaEqnCicsam(const VectorFiniteVolumeField &u, Scalar timeStep)
+{
+    //- Cell Courant numbers are computed once and shared with the face weighting
+    fv::courantNumber(u, timeStep, co_);
+    auto beta = cicsam::faceInterpolationWeights(u, gamma_, gradGamma_, co_);
 
     //- Predictor
     gamma_.savePreviousTimeStep(timeStep, 1);
-    gammaEqn_ = (fv::ddt(gamma_, timeStep) + cicsam::div(u_, gamma_, beta, 0.) == 0.);
+    gammaEqn_ = (fv::ddt(gamma_, timeStep) + cicsam::div(u, gamma_, beta, 0.) == 0.);
     Scalar error = gammaEqn_.solve();
     gamma_.sendMessages();
 
@@ -112,7 +177,7 @@ Scalar FractionalStepDirectForcingMultiphase::solveGammaEqn(Scalar timeStep)
     for(const Cell &c: *fluid_)
         gammaSrc_(c) = (gamma_(c) - gamma_.prevIteration()(c)) / timeStep;
 
-    gammaEqn_ == cicsam::div(u_, gamma_, beta, 0.5) - cicsam::div(u_, gamma_, beta, 0.) + src::src(gammaSrc_);
+    gammaEqn_ == cicsam::div(u, gamma_, beta, 0.5) - cicsam::div(u, gamma_, beta, 0.) + src::src(gammaSrc_);
 
     error = gammaEqn_.solve();
     gamma_.sendMessages();
@@ -125,6 +190,47 @@ Scalar FractionalStepDirectForcingMultiphase::solveGammaEqn(Scalar timeStep)
     return error;
 }
 
+Scalar FractionalStepDirectForcingMultiphase::solveGammaEqnPlic(const VectorFiniteVolumeField &u, Scalar timeStep)
+{
+    //- Explicit geometric advection, the gradient is still valid for the previous time level
+    gamma_.savePreviousTimeStep(timeStep, 1);
+    Scalar clippedVolume = plic::advect(u, gradGamma_, gamma_, timeStep, *fluid_);
+    gamma_.sendMessages();
+
+    grid_->comm().printf("PLIC bounded volume = %.4e\n", clippedVolume);
+
+    fst_->computeContactLineExtension(gamma_);
+    gamma_.sendMessages();
+    gamma_.interpolateFaces();
+
+    //- Update the gradient
+    gradGamma_.compute(*fluid_);
+    gradGamma_.sendMessages();
+
+    return clippedVolume;
+}
+
+int FractionalStepDirectForcingMultiphase::nGammaSubCycles(Scalar timeStep)
+{
+    fv::courantNumber(u_, timeStep, co_);
+
+    Scalar maxCo = 0., maxInterfaceCo = 0.;
+
+    for (const Cell &cell: *fluid_)
+    {
+        maxCo = std::max(co_(cell), maxCo);
+
+        if (gamma_(cell) > 1e-8 && gamma_(cell) < 1. - 1e-8)
+            maxInterfaceCo = std::max(co_(cell), maxInterfaceCo);
+    }
+
+    //- A cell Courant number bounds the face Courant numbers of its outgoing faces
+    Scalar maxGammaCo = gammaScheme_ == PLIC ? std::min(maxGammaCo_, plic::maxCo) : maxGammaCo_;
+    Scalar nSubCycles = std::max(std::ceil(maxInterfaceCo / maxInterfaceCo_), std::ceil(maxCo / maxGammaCo));
+
+    return (int) grid_->comm().max(clamp(nSubCycles, 1., (Scalar) maxGammaSubCycles_));
+}
+
 Scalar FractionalStepDirectForcingMultiphase::solveUEqn(Scalar timeStep)
 {
     auto &fst = *fst_->fst();
@@ -209,36 +315,38 @@ void FractionalStepDirectForcingMultiphase::solveExtEqns()
 
 void FractionalStepDirectForcingMultiphase::updateProperties(Scalar timeStep)
 {
-    //- Update density
-    rho_.savePreviousTimeStep(timeStep, 1);
+    //- Every value is recomputed below, so the history is rotated without copying
+    rho_.rotatePreviousTimeStep(timeStep, 1);
+    mu_.rotatePreviousTimeStep(timeStep, 1);
+    sg_.rotatePreviousTimeStep(timeStep, 1);
 
-    rho_.computeCells([this](const Cell &c) {
-        return rho1_ + clamp(gamma_(c), 0., 1.) * (rho2_ - rho1_);
-    });
+    //- Inverse kinematic viscosities of both phases
+    Scalar rnu1 = rho1_ / mu1_, rnu2 = rho2_ / mu2_;
 
-    rho_.computeFaces([this](const Face &f) {
-        return rho1_ + clamp(gamma_(f), 0., 1.) * (rho2_ - rho1_);
-    });
-
-    //- Update the gravitational source term
-    gradRho_.computeFaces();
-    sg_.savePreviousTimeStep(timeStep, 1);
-    for (const Face &face: grid_->faces())
-        sg_(face) = -dot(g_, face.centroid()) * gradRho_(face);
+    //- Density and viscosity (from kinematic viscosity) in one cell pass
+    for (const Cell &c: grid_->cells())
+    {
+        Scalar g = clamp(gamma_(c), 0., 1.);
+        rho_(c) = rho1_ + g * (rho2_ - rho1_);
+        mu_(c) = rho_(c) / (rnu1 + g * (rnu2 - rnu1));
+    }
 
-    sg_.faceToCell(rho_, rho_, *fluid_);
-    sg_.sendMessages();
+    //- Face properties, density gradient and gravitational source in one face pass
+    for (const Face &f: grid_->faces())
+    {
+        Scalar g = clamp(gamma_(f), 0., 1.);
+        rho_(f) = rho1_ + g * (rho2_ - rho1_);
+        mu_(f) = rho_(f) / (rnu1 + g * (rnu2 - rnu1));
 
-    //- Update viscosity from kinematic viscosity
-    mu_.savePreviousTimeStep(timeStep, 1);
+        Vector2D r = f.isBoundary() ? f.centroid() - f.lCell().centroid() : f.rCell().centroid() - f.lCell().centroid();
+        Scalar drho = f.isBoundary() ? rho_(f) - rho_(f.lCell()) : rho_(f.rCell()) - rho_(f.lCell());
 
-    mu_.computeCells([this](const Cell &c) {
-        return rho_(c) / (rho1_ / mu1_ + clamp(gamma_(c), 0., 1.) * (rho2_ / mu2_ - rho1_ / mu1_));
-    });
+        gradRho_(f) = drho * r / r.magSqr();
+        sg_(f) = -dot(g_, f.centroid()) * gradRho_(f);
+    }
 
-    mu_.computeFaces([this](const Face &f) {
-        return rho_(f) / (rho1_ / mu1_ + clamp(gamma_(f), 0., 1.) * (rho2_ / mu2_ - rho1_ / mu1_));
-    });
+    sg_.faceToCell(rho_, rho_, *fluid_);
+    sg_.sendMessages();
 
     //- Update the surface tension
     fst_->fst()->savePreviousTimeStep(timeStep, 1);
@@ -281,9 +389,15 @@ void FractionalStepDirectForcingMultiphase::correctVelocity(Scalar timeStep)
 
 void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
 {
-    for(auto &ibObj: *ib_)
+    const auto &ibObjs = ib_->ibObjs();
+
+    contactLines_.assign(ibObjs.size(), std::vector<ContactLine>());
+    std::vector<Vector2D> fh(ibObjs.size(), Vector2D(0., 0.));
+
+    //- Local contributions of all objects first, so that they can be communicated at once
+    for(Label i = 0; i < ibObjs.size(); ++i)
     {
-        contactLines_.clear();
+        const auto &ibObj = ibObjs[i];
 
         auto computeContactLine = [&ibObj](const Cell &c)
         {
@@ -306,7 +420,7 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             Point2D pt = ibObj->nearestIntersect(c.centroid());
             Scalar beta = (pt - ibObj->shape().centroid()).angle();
 
-            CelesteImmersedBoundary::ContactLineStencil st1(*ibObj, pt, fst_->theta(*ibObj), gamma_);
+            const auto &st1 = fst_->contactLineStencil(*ibObj, c, gamma_, true);
 
             Scalar rho = st1.interpolate(rho_);
             Scalar rgh = rho * dot(g_, pt - ibObj->shape().centroid());
@@ -314,12 +428,43 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             Vector2D ncl = st1.ncl();
             Vector2D tcl = st1.tcl();
 
-            contactLines_.push_back(ContactLine{pt, beta, rho, rgh, gamma, ncl, tcl});
+            contactLines_[i].push_back(ContactLine{pt, beta, rho, rgh, gamma, ncl, tcl});
+        }
+
+        //- Compute the hydro force from the ib force
+        for(const Cell &c: ibObj->cells())
+        {
+            fh[i] += rho_(c) * (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
+
+            for(const InteriorLink &nb: c.neighbours())
+            {
+                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(nb.face()), nb.outwardNorm()) / 2.;
+                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(nb.face()), nb.outwardNorm()) / 2.;
+                fh[i] += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
+                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(nb.cell());
+            }
+
+            for(const BoundaryLink &bd: c.boundaries())
+            {
+                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(bd.face()), bd.outwardNorm()) / 2.;
+                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(bd.face()), bd.outwardNorm()) / 2.;
+                fh[i] += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
+                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(bd.face());
+            }
+
+            fh[i] -= (fb_(c) + (*fst_->fst())(c) + rho_(c) * g_) * c.volume();
         }
+    }
 
-        contactLines_ = grid_->comm().allGatherv(contactLines_);
+    contactLines_ = ib_->gather(contactLines_);
+    fh = ib_->sum(fh);
 
-        std::sort(contactLines_.begin(), contactLines_.end(), [](const ContactLine &lhs, const ContactLine &rhs)
+    for(Label i = 0; i < ibObjs.size(); ++i)
+    {
+        const auto &ibObj = ibObjs[i];
+        auto &contactLines = contactLines_[i];
+
+        std::sort(contactLines.begin(), contactLines.end(), [](const ContactLine &lhs, const ContactLine &rhs)
         { return lhs.beta < rhs.beta; });
 
         Vector2D fc(0., 0.);
@@ -329,10 +474,10 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             const Circle &circ = static_cast<const Circle&>(ibObj->shape());
             Scalar r = circ.radius();
 
-            for(auto i = 0; i < contactLines_.size(); ++i)
+            for(auto j = 0; j < contactLines.size(); ++j)
             {
-                const ContactLine &stA = contactLines_[i];
-                const ContactLine &stB = contactLines_[(i + 1) % contactLines_.size()];
+                const ContactLine &stA = contactLines[j];
+                const ContactLine &stB = contactLines[(j + 1) % contactLines.size()];
 
                 Scalar tA = stA.beta;
                 Scalar tB = stB.beta < tA ? stB.beta + 2. * M_PI : stB.beta;
@@ -360,43 +505,16 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             }
         }
 
-        //- Compute the hydro force from the ib force
-        Vector2D fh(0., 0.);
-        for(const Cell &c: ibObj->cells())
-        {
-            fh += rho_(c) * (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
-
-            for(const InteriorLink &nb: c.neighbours())
-            {
-                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(nb.face()), nb.outwardNorm()) / 2.;
-                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(nb.face()), nb.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
-                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(nb.cell());
-            }
-
-            for(const BoundaryLink &bd: c.boundaries())
-            {
-                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(bd.face()), bd.outwardNorm()) / 2.;
-                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(bd.face()), bd.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
-                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(bd.face());
-            }
-
-            fh -= (fb_(c) + (*fst_->fst())(c) + rho_(c) * g_) * c.volume();
-        }
-
-        fh = grid_->comm().sum(fh);
-
         Vector2D fw = ibObj->rho * ibObj->shape().area() * g_;
 
-        if(grid_->comm().isMainProc())
-            std::cout << "Hydrodynamic force = " << fh << "\n"
-                      << "Net IB force = " << fh << "\n"
+        if(grid_->comm().isMainProc() && ibObj->isReplicated())
+            std::cout << "Hydrodynamic force = " << fh[i] << "\n"
+                      << "Net IB force = " << fh[i] << "\n"
                       << "Capillary force = " << fc << "\n"
                       << "Weight = " << fw << "\n"
-                      << "Net = " << fh + fc + fw << "\n";
+                      << "Net = " << fh[i] + fc + fw << "\n";
 
 
-        ibObj->applyForce(fh + fc + fw);
+        ibObj->applyForce(fh[i] + fc + fw);
     }
 }
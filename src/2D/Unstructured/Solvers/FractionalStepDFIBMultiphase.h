@@ -14,6 +14,11 @@ public:
 
     Scalar solve(Scalar timeStep) override;
 
+    Scalar computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const override;
+
+    std::shared_ptr<const CelesteImmersedBoundary> ibSurfaceTension() const override
+    { return fst_; }
+
 protected:
 
     //- This class is used to communicate contact line info
@@ -28,8 +33,18 @@ protected:
         Vector2D ncl, tcl;
     };
 
+    //- Volume fraction advection schemes
+    enum GammaScheme {CICSAM, PLIC};
+
     Scalar solveGammaEqn(Scalar timeStep);
 
+    Scalar solveGammaEqnCicsam(const VectorFiniteVolumeField &u, Scalar timeStep);
+
+    Scalar solveGammaEqnPlic(const VectorFiniteVolumeField &u, Scalar timeStep);
+
+    //- Number of gamma sub-steps, from the interface and flow Courant numbers of a full step
+    int nGammaSubCycles(Scalar timeStep);
+
     virtual Scalar solveUEqn(Scalar timeStep) override;
 
     virtual Scalar solvePEqn(Scalar timeStep) override;
@@ -44,6 +59,15 @@ protected:
 
     Scalar rho1_, rho2_, mu1_, mu2_, capillaryTimeStep_;
 
+    GammaScheme gammaScheme_;
+
+    //- Gamma sub-cycling
+    bool subCycleGamma_;
+
+    int maxGammaSubCycles_;
+
+    Scalar maxInterfaceCo_, maxGammaCo_;
+
     ScalarFiniteVolumeField &gamma_, &rho_, &mu_, &gammaSrc_;
 
     VectorFiniteVolumeField &sg_;
@@ -54,7 +78,8 @@ protected:
 
     FiniteVolumeEquation<Scalar> gammaEqn_;
 
-    std::vector<ContactLine> contactLines_;
+    //- Contact lines of each immersed boundary object
+    std::vector<std::vector<ContactLine>> contactLines_;
 };
 
 #endif
@@ -5,6 +5,7 @@
 #include "FiniteVolume/Discretization/Laplacian.h"
 #include "FiniteVolume/Discretization/Source.h"
 #include "FiniteVolume/Discretization/Cicsam.h"
+#include "FiniteVolume/Discretization/Courant.h"
 
 #include "FractionalStepMultiphase.h"
 
@@ -76,7 +77,9 @@ Scalar FractionalStepMultiphase::solve(Scalar timeStep)
 
 Scalar FractionalStepMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
+    //- Cell Courant numbers are computed once and shared with the face weighting
+    fv::courantNumber(u_, timeStep, co_);
+    auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, co_);
 
     //- Advect volume fractions
     gamma_.savePreviousTimeStep(timeStep, 1);
@@ -173,7 +176,7 @@ void FractionalStepMultiphase::correctVelocity(Scalar timeStep)
 void FractionalStepMultiphase::updateProperties(Scalar timeStep)
 {
     //- Update density
-    rho_.savePreviousTimeStep(timeStep, 1);
+    rho_.rotatePreviousTimeStep(timeStep, 1);
 
     rho_.computeCells([this](const Cell &cell) {
         return rho1_ + clamp(gamma_(cell), 0., 1.) * (rho2_ - rho1_);
@@ -196,7 +199,7 @@ void FractionalStepMultiphase::updateProperties(Scalar timeStep)
     sg_.sendMessages();
 
     //- Update viscosity from kinematic viscosity
-    mu_.savePreviousTimeStep(timeStep, 1);
+    mu_.rotatePreviousTimeStep(timeStep, 1);
 
     mu_.computeCells([this](const Cell &cell) {
         return rho_(cell) / (rho1_ / mu1_ + clamp(gamma_(cell), 0., 1.) * (rho2_ / mu2_ - rho1_ / mu1_));
@@ -7,6 +7,7 @@
 #include "System/CgnsFile.h"
 
 #include "Solver.h"
+#include "Checkpoint.h"
 
 Solver::Solver(const Input &input, const std::shared_ptr<const FiniteVolumeGrid2D> &grid)
     :
@@ -19,6 +20,8 @@ Solver::Solver(const Input &input, const std::shared_ptr<const FiniteVolumeGrid2
     //- Index map
     scalarIndexMap_ = std::make_shared<IndexMap>(*grid_, 1);
     vectorIndexMap_ = std::make_shared<IndexMap>(*grid_, 2);
+
+    checkpoint_ = std::make_shared<Checkpoint>(input, *this);
 }
 
 int Solver::printf(const char *format, ...) const
@@ -41,6 +44,20 @@ Scalar Solver::getStartTime() const
     return startTime_;
 }
 
+void Solver::writeCheckpoint(Scalar time, Scalar timeStep)
+{
+    checkpoint_->write(time, timeStep);
+}
+
+bool Solver::readCheckpoint(Scalar &time, Scalar &timeStep)
+{
+    if (!checkpoint_->read(time, timeStep))
+        return false;
+
+    startTime_ = time;
+    return true;
+}
+
 std::shared_ptr<FiniteVolumeField<int> > Solver::integerField(const std::string &name) const
 {
     auto it = integerFields_.find(name);
@@ -320,7 +337,8 @@ void Solver::setInitialConditions(const Input &input)
 
 void Solver::setInitialConditions(const CommandLine &cl, const Input &input)
 {
-    if (cl.get<bool>("restart"))
+    //- A checkpoint is read once the solver is initialized, until then the initial conditions are used
+    if (cl.get<bool>("restart") && !checkpoint_->exists())
         restartSolution(input);
     else
         setInitialConditions(input);
@@ -10,6 +10,8 @@
 #include "FiniteVolume/ImmersedBoundary/ImmersedBoundary.h"
 
 class CgnsFile;
+class CelesteImmersedBoundary;
+class Checkpoint;
 
 class Solver : public SolverInterface
 {
@@ -40,6 +42,11 @@ public:
 
     Scalar getStartTime() const;
 
+    //- Checkpoints
+    virtual void writeCheckpoint(Scalar time, Scalar timeStep) override;
+
+    virtual bool readCheckpoint(Scalar &time, Scalar &timeStep) override;
+
     //- Field management
 
     template<class T>
@@ -81,6 +88,10 @@ public:
     virtual std::shared_ptr<const ImmersedBoundary> ib() const
     { return nullptr; }
 
+    //- Surface tension with contact lines on the IBs, if applicable
+    virtual std::shared_ptr<const CelesteImmersedBoundary> ibSurfaceTension() const
+    { return nullptr; }
+
 protected:
 
     void setCircle(const Circle &circle, Scalar innerValue, ScalarFiniteVolumeField &field);
@@ -133,6 +144,8 @@ protected:
     //- Solver parameters
     Scalar startTime_, maxTimeStep_;
 
+    std::shared_ptr<Checkpoint> checkpoint_;
+
     //- Misc
     bool isRestart_;
 };
@@ -9,7 +9,11 @@ int main(int argc, char *argv[])
 {
     using namespace std;
 
-    Communicator::init(argc, argv);
+    //- The input is read first, the MPI thread level depends on the post-processing settings
+    Input input;
+    input.parseInputFile();
+
+    Communicator::init(argc, argv, PostProcessing::requiredThreadSupport(input));
 
     CommandLine cl;
 
@@ -18,15 +22,13 @@ int main(int argc, char *argv[])
 
     cl.parseArguments(argc, argv);
 
-    Input input;
-    input.parseInputFile();
-
     std::shared_ptr<FiniteVolumeGrid2D> grid = FiniteVolumeGrid2DFactory::create(cl, input);
 
     std::shared_ptr<Solver> solver = SolverFactory::create(input, grid);
 
     PostProcessing postProcessing(cl, input, *solver);
     postProcessing.initIbPostProcessingObjects(input, *solver);
+    postProcessing.initFieldPostProcessingObjects(input, *solver);
 
     RunControl runControl;
 
@@ -197,6 +197,30 @@ Matrix &Matrix::pinvert()
     return (*this = _tmp);
 }
 
+bool Matrix::choleskyPinvert(Scalar minRcond)
+{
+    //- Upper triangle of A^T A
+    _tmp.resize(n_, n_);
+    cblas_dsyrk(CblasRowMajor, CblasUpper, CblasTrans, n_, m_, 1., data(), n_, 0., _tmp.data(), n_);
+
+    Scalar anorm = LAPACKE_dlansy(LAPACK_ROW_MAJOR, '1', 'U', n_, _tmp.data(), n_);
+
+    if (LAPACKE_dpotrf(LAPACK_ROW_MAJOR, 'U', n_, _tmp.data(), n_) != 0)
+        return false;
+
+    Scalar rcond;
+    LAPACKE_dpocon(LAPACK_ROW_MAJOR, 'U', n_, _tmp.data(), n_, anorm, &rcond);
+
+    if (rcond < minRcond)
+        return false;
+
+    //- (A^T A)^-1 A^T
+    transpose();
+    LAPACKE_dpotrs(LAPACK_ROW_MAJOR, 'U', m_, n_, _tmp.data(), m_, data(), n_);
+
+    return true;
+}
+
 Scalar Matrix::norm(char type) const
 {
     return LAPACKE_dlange(LAPACK_ROW_MAJOR, type, m_, n_, data(), n_);
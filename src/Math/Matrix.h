@@ -58,6 +58,9 @@ public:
 
     Matrix &pinvert();
 
+    //- Pseudo-inverse from a Cholesky factorization of the normal equations, left unchanged if rcond(A^T A) < minRcond
+    bool choleskyPinvert(Scalar minRcond);
+
     Scalar norm(char type = 'I') const;
 
     Scalar cond(char type = 'I') const;
@@ -1,5 +1,6 @@
 #include <numeric>
 #include <regex>
+#include <cstring>
 
 #include <cgnslib.h>
 
@@ -470,42 +471,48 @@ CgnsFile::Field<double> CgnsFile::readField(int bid, int zid, int sid, int rmin,
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<int> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const int *field, Size size)
 {
     int fid;
-    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(Integer), fieldname.c_str(), field.data(), &fid);
+    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(Integer), fieldname.c_str(), field, &fid);
     return fid;
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Label> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const Label *field, Size size)
 {
-    return writeField(bid, zid, sid, fieldname, std::vector<int>(field.begin(), field.end()));
+    //- Stored as 64 bit integers, avoids narrowing into a temporary
+    int fid;
+    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(LongInteger), fieldname.c_str(), field, &fid);
+    return fid;
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<double> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const double *field, Size size)
 {
     int fid;
-    auto data = field;
-    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealDouble), fieldname.c_str(), data.data(), &fid);
+    cg_field_write(_fid, bid, zid, sid, CGNS_ENUMV(RealDouble), fieldname.c_str(), field, &fid);
     return fid;
 }
 
 template<>
-int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<Vector2D> &field)
+int CgnsFile::writeField(int bid, int zid, int sid, const std::string &fieldname, const Vector2D *field, Size size)
 {
+    //- The vectors are seen as a 2 x size array in memory, each component is one row of it
     int fid;
-    std::vector<double> xComp(field.size()), yComp(field.size());
+    cgsize_t rmin = 1, rmax = size;
+    cgsize_t mDims[] = {2, (cgsize_t) size};
+    const char *suffix[] = {"X", "Y"};
 
-    std::transform(field.begin(), field.end(), xComp.begin(), [](const Vector2D &u)
-    { return u.x; });
-
-    std::transform(field.begin(), field.end(), yComp.begin(), [](const Vector2D &u)
-    { return u.y; });
+    for (cgsize_t c = 0; c < 2; ++c)
+    {
+        cgsize_t mRmin[] = {c + 1, 1}, mRmax[] = {c + 1, (cgsize_t) size};
 
-    writeField(bid, zid, sid, fieldname + "X", xComp);
-    writeField(bid, zid, sid, fieldname + "Y", yComp);
+        cg_field_general_write(_fid, bid, zid, sid, (fieldname + suffix[c]).c_str(), CGNS_ENUMV(RealDouble),
+                               &rmin, &rmax,
+                               CGNS_ENUMV(RealDouble), 2, mDims, mRmin, mRmax,
+                               field, &fid);
+    }
 
     return fid;
 }
@@ -550,3 +557,95 @@ std::vector<std::pair<std::string, std::string>> CgnsFile::readDescriptorNodes(i
 
     return descriptors;
 }
+
+//- Global ids
+
+void CgnsFile::writeGlobalIds(int bid, int zid, const std::string &name, const std::vector<Label> &ids)
+{
+    cg_goto(_fid, bid, "Zone_t", zid, "end");
+    writeGlobalIds(name, ids);
+}
+
+void CgnsFile::writeGlobalIds(int bid, int zid, int bcid, const std::string &name, const std::vector<Label> &ids)
+{
+    cg_goto(_fid, bid, "Zone_t", zid, "ZoneBC_t", 1, "BC_t", bcid, "end");
+    writeGlobalIds(name, ids);
+}
+
+std::vector<Label> CgnsFile::readGlobalIds(int bid, int zid, const std::string &name) const
+{
+    cg_goto(_fid, bid, "Zone_t", zid, "end");
+    return readGlobalIds(name);
+}
+
+std::vector<Label> CgnsFile::readGlobalIds(int bid, int zid, int bcid, const std::string &name) const
+{
+    cg_goto(_fid, bid, "Zone_t", zid, "ZoneBC_t", 1, "BC_t", bcid, "end");
+    return readGlobalIds(name);
+}
+
+//- Protected
+
+static int findUserData(const char *username)
+{
+    int nuserdata;
+    cg_nuser_data(&nuserdata);
+
+    for (int u = 1; u <= nuserdata; ++u)
+    {
+        char name[33];
+        cg_user_data_read(u, name);
+
+        if (strcmp(name, username) == 0)
+            return u;
+    }
+
+    return 0;
+}
+
+void CgnsFile::writeGlobalIds(const std::string &name, const std::vector<Label> &ids)
+{
+    int u = findUserData("GlobalIDs");
+
+    if (u == 0)
+    {
+        cg_user_data_write("GlobalIDs");
+        u = findUserData("GlobalIDs");
+    }
+
+    cg_gorel(_fid, "UserDefinedData_t", u, "end");
+
+    cgsize_t size = ids.size();
+    cg_array_write(name.c_str(), CGNS_ENUMV(LongInteger), 1, &size, ids.data());
+}
+
+std::vector<Label> CgnsFile::readGlobalIds(const std::string &name) const
+{
+    int u = findUserData("GlobalIDs");
+
+    if (u == 0)
+        return std::vector<Label>();
+
+    cg_gorel(_fid, "UserDefinedData_t", u, "end");
+
+    int narrays;
+    cg_narrays(&narrays);
+
+    for (int a = 1; a <= narrays; ++a)
+    {
+        char arrayname[33];
+        CGNS_ENUMT(DataType_t) type;
+        int dataDim;
+        cgsize_t dimVals[12];
+        cg_array_info(a, arrayname, &type, &dataDim, dimVals);
+
+        if (name == arrayname)
+        {
+            std::vector<Label> ids(dimVals[0]);
+            cg_array_read_as(a, CGNS_ENUMV(LongInteger), ids.data());
+            return ids;
+        }
+    }
+
+    return std::vector<Label>();
+}
@@ -138,7 +138,12 @@ public:
     Field<T> readField(int bid, int zid, int sid, int rmin, int rmax, const std::string& fieldname) const;
 
     template<class T>
-    int writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<T> &field);
+    int writeField(int bid, int zid, int sid, const std::string &fieldname, const std::vector<T> &field)
+    { return writeField(bid, zid, sid, fieldname, field.data(), field.size()); }
+
+    //- Writes size values straight from memory, vector components are written with strided selections
+    template<class T>
+    int writeField(int bid, int zid, int sid, const std::string &fieldname, const T *field, Size size);
 
     //- Descriptors
 
@@ -150,8 +155,22 @@ public:
 
     std::vector<std::pair<std::string, std::string>> readDescriptorNodes(int bid, int zid, int sid) const;
 
+    //- Global ids, stored as arrays in a "GlobalIDs" user data node of a zone or boundary condition.
+    //  Reading returns an empty vector if the array does not exist
+    void writeGlobalIds(int bid, int zid, const std::string &name, const std::vector<Label> &ids);
+
+    void writeGlobalIds(int bid, int zid, int bcid, const std::string &name, const std::vector<Label> &ids);
+
+    std::vector<Label> readGlobalIds(int bid, int zid, const std::string &name) const;
+
+    std::vector<Label> readGlobalIds(int bid, int zid, int bcid, const std::string &name) const;
+
 protected:
 
+    void writeGlobalIds(const std::string &name, const std::vector<Label> &ids);
+
+    std::vector<Label> readGlobalIds(const std::string &name) const;
+
     int _fid;
 };
 
@@ -7,10 +7,11 @@
 
 MPI_Datatype Communicator::MPI_VECTOR2D_;
 MPI_Datatype Communicator::MPI_TENSOR2D_;
+int Communicator::threadSupport_ = MPI_THREAD_SINGLE;
 
-void Communicator::init(int argc, char *argv[])
+void Communicator::init(int argc, char *argv[], int threadLevel)
 {
-    MPI_Init(&argc, &argv);
+    MPI_Init_thread(&argc, &argv, threadLevel, &threadSupport_);
     MPI_Type_vector(1, 2, 2, MPI_DOUBLE, &MPI_VECTOR2D_);
     MPI_Type_vector(1, 4, 4, MPI_DOUBLE, &MPI_TENSOR2D_);
     MPI_Type_commit(&MPI_VECTOR2D_);
@@ -130,6 +131,13 @@ Vector2D Communicator::sum(const Vector2D &val) const
     return result;
 }
 
+std::vector<Vector2D> Communicator::sum(const std::vector<Vector2D> &vals) const
+{
+    std::vector<Vector2D> result(vals.size());
+    MPI_Allreduce(vals.data(), result.data(), 2 * vals.size(), MPI_DOUBLE, MPI_SUM, comm_);
+    return result;
+}
+
 Tensor2D Communicator::sum(const Tensor2D &val) const
 {
     Tensor2D result;
@@ -15,10 +15,15 @@ class Communicator
 {
 public:
 
-    static void init(int argc, char *argv[]);
+    //- Only the main thread makes MPI calls unless a higher thread level is requested
+    static void init(int argc, char *argv[], int threadLevel = MPI_THREAD_FUNNELED);
 
     static void finalize();
 
+    //- Thread support level provided by the MPI library
+    static int threadSupport()
+    { return threadSupport_; }
+
     Communicator(MPI_Comm comm = MPI_COMM_WORLD);
 
     ~Communicator();
@@ -155,6 +160,8 @@ public:
 
     Vector2D sum(const Vector2D &val) const;
 
+    std::vector<Vector2D> sum(const std::vector<Vector2D> &vals) const;
+
     Tensor2D sum(const Tensor2D &val) const;
 
     Vector3D sum(const Vector3D &val) const;
@@ -174,6 +181,8 @@ private:
 
     static MPI_Datatype MPI_VECTOR2D_, MPI_TENSOR2D_;
 
+    static int threadSupport_;
+
     MPI_Comm comm_;
 
     mutable std::vector<MPI_Request> currentRequests_;
@@ -0,0 +1,392 @@
+#include <type_traits>
+#include <algorithm>
+#include <numeric>
+
+#include "Hdf5File.h"
+#include "Exception.h"
+
+//- Registered id of the zstd filter plugin
+static const H5Z_filter_t zstdFilter = 32015;
+
+namespace
+{
+    //- Closes an HDF5 identifier when leaving scope, so a failed call does not leak the others
+    class Handle
+    {
+    public:
+
+        Handle(hid_t id, herr_t (*close)(hid_t))
+            :
+              id_(id),
+              close_(close)
+        {}
+
+        Handle(const Handle &) = delete;
+
+        Handle &operator=(const Handle &) = delete;
+
+        ~Handle()
+        {
+            if (id_ >= 0)
+                close_(id_);
+        }
+
+        operator hid_t() const
+        { return id_; }
+
+    private:
+
+        hid_t id_;
+
+        herr_t (*close_)(hid_t);
+    };
+}
+
+//- Native types
+
+template<>
+hid_t Hdf5File::nativeType<char>()
+{ return H5T_NATIVE_CHAR; }
+
+template<>
+hid_t Hdf5File::nativeType<int>()
+{ return H5T_NATIVE_INT; }
+
+template<>
+hid_t Hdf5File::nativeType<long>()
+{ return H5T_NATIVE_LONG; }
+
+template<>
+hid_t Hdf5File::nativeType<unsigned long>()
+{ return H5T_NATIVE_ULONG; }
+
+template<>
+hid_t Hdf5File::nativeType<float>()
+{ return H5T_NATIVE_FLOAT; }
+
+template<>
+hid_t Hdf5File::nativeType<double>()
+{ return H5T_NATIVE_DOUBLE; }
+
+template<class T>
+T Hdf5File::check(T status, const std::string &method, const std::string &what)
+{
+    if (status < 0)
+        throw Exception("Hdf5File", method, "HDF5 error, " + what + ".");
+
+    return status;
+}
+
+Hdf5File::Hdf5File()
+    :
+      fid_(-1),
+      dxpl_(-1)
+{
+
+}
+
+Hdf5File::Hdf5File(const std::string &filename, Mode mode, const Communicator &comm)
+    :
+      Hdf5File()
+{
+    open(filename, mode, comm);
+}
+
+Hdf5File::~Hdf5File()
+{
+    close();
+}
+
+void Hdf5File::open(const std::string &filename, Mode mode, const Communicator &comm)
+{
+    close();
+
+    Handle fapl(check(H5Pcreate(H5P_FILE_ACCESS), "open", "unable to create file access properties"), H5Pclose);
+    dxpl_ = check(H5Pcreate(H5P_DATASET_XFER), "open", "unable to create transfer properties");
+
+#ifdef H5_HAVE_PARALLEL
+    check(H5Pset_fapl_mpio(fapl, comm.communicator(), MPI_INFO_NULL), "open", "unable to set MPI-IO file access");
+    check(H5Pset_dxpl_mpio(dxpl_, H5FD_MPIO_COLLECTIVE), "open", "unable to set collective transfers");
+#else
+    if (comm.nProcs() > 1)
+        throw Exception("Hdf5File", "open", "HDF5 was built without MPI-IO, a parallel HDF5 library is required.");
+#endif
+
+    switch (mode)
+    {
+    case READ:
+        fid_ = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, fapl);
+        break;
+
+    case WRITE:
+        fid_ = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+        break;
+
+    case MODIFY:
+        fid_ = H5Fopen(filename.c_str(), H5F_ACC_RDWR, fapl);
+        break;
+    }
+
+    if (fid_ < 0)
+        throw Exception("Hdf5File", "open", "unable to open file \"" + filename + "\".");
+}
+
+void Hdf5File::close()
+{
+    if (dxpl_ >= 0)
+        H5Pclose(dxpl_);
+
+    if (fid_ >= 0)
+        H5Fclose(fid_);
+
+    fid_ = dxpl_ = -1;
+}
+
+void Hdf5File::flush()
+{
+    check(H5Fflush(fid_, H5F_SCOPE_GLOBAL), "flush", "unable to flush the file");
+}
+
+bool Hdf5File::exists(const std::string &path) const
+{
+    return check(H5Lexists(fid_, path.c_str(), H5P_DEFAULT), "exists", "unable to look up \"" + path + "\"") > 0;
+}
+
+void Hdf5File::createGroup(const std::string &path)
+{
+    Handle gid(check(H5Gcreate(fid_, path.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT),
+                     "createGroup", "unable to create group \"" + path + "\""), H5Gclose);
+}
+
+template<class T>
+void Hdf5File::createDataset(const std::string &path,
+                             const std::vector<hsize_t> &dims,
+                             const std::vector<hsize_t> &maxDims,
+                             const std::vector<hsize_t> &chunk,
+                             const Filters &filters)
+{
+    if (filters.zstdLevel > 0 && H5Zfilter_avail(zstdFilter) <= 0)
+        throw Exception("Hdf5File", "createDataset", "the zstd filter plugin is not available, check HDF5_PLUGIN_PATH.");
+
+    std::string what = "unable to create dataset \"" + path + "\"";
+
+    Handle space(check(H5Screate_simple(dims.size(), dims.data(), maxDims.data()), "createDataset", what), H5Sclose);
+    Handle dcpl(check(H5Pcreate(H5P_DATASET_CREATE), "createDataset", what), H5Pclose);
+
+    check(H5Pset_chunk(dcpl, chunk.size(), chunk.data()), "createDataset", what);
+
+    if (filters.decimalDigits >= 0 && std::is_floating_point<T>::value)
+        check(H5Pset_scaleoffset(dcpl, H5Z_SO_FLOAT_DSCALE, filters.decimalDigits), "createDataset", what);
+
+    if (filters.shuffle)
+        check(H5Pset_shuffle(dcpl), "createDataset", what);
+
+    if (filters.deflateLevel > 0)
+        check(H5Pset_deflate(dcpl, filters.deflateLevel), "createDataset", what);
+    else if (filters.zstdLevel > 0)
+    {
+        unsigned int level = filters.zstdLevel;
+        check(H5Pset_filter(dcpl, zstdFilter, H5Z_FLAG_MANDATORY, 1, &level), "createDataset", what);
+    }
+
+    Handle did(check(H5Dcreate(fid_, path.c_str(), nativeType<T>(), space, H5P_DEFAULT, dcpl, H5P_DEFAULT),
+                     "createDataset", what), H5Dclose);
+}
+
+std::vector<hsize_t> Hdf5File::dims(const std::string &path) const
+{
+    std::string what = "unable to read the dimensions of \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "dims", what), H5Dclose);
+    Handle space(check(H5Dget_space(did), "dims", what), H5Sclose);
+
+    std::vector<hsize_t> dims(check(H5Sget_simple_extent_ndims(space), "dims", what));
+    check(H5Sget_simple_extent_dims(space, dims.data(), nullptr), "dims", what);
+
+    return dims;
+}
+
+void Hdf5File::extend(const std::string &path, const std::vector<hsize_t> &dims)
+{
+    std::string what = "unable to extend \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "extend", what), H5Dclose);
+    check(H5Dset_extent(did, dims.data()), "extend", what);
+}
+
+template<class T>
+void Hdf5File::write(const std::string &path,
+                     const T *data,
+                     const std::vector<hsize_t> &offset,
+                     const std::vector<hsize_t> &count)
+{
+    std::string what = "unable to write \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "write", what), H5Dclose);
+    Handle fspace(check(H5Dget_space(did), "write", what), H5Sclose);
+    Handle mspace(check(H5Screate_simple(count.size(), count.data(), nullptr), "write", what), H5Sclose);
+
+    selectBlock(mspace, fspace, offset, count);
+
+    check(H5Dwrite(did, nativeType<T>(), mspace, fspace, dxpl_, data), "write", what);
+}
+
+template<class T>
+void Hdf5File::write(const std::string &path,
+                     const T *data,
+                     hsize_t memSize,
+                     const std::vector<hsize_t> &memRows,
+                     const std::vector<hsize_t> &fileRows,
+                     const std::vector<hsize_t> &prefix,
+                     int nRowDims)
+{
+    std::string what = "unable to write \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "write", what), H5Dclose);
+    Handle fspace(check(H5Dget_space(did), "write", what), H5Sclose);
+
+    std::vector<hsize_t> dims(check(H5Sget_simple_extent_ndims(fspace), "write", what));
+    check(H5Sget_simple_extent_dims(fspace, dims.data(), nullptr), "write", what);
+
+    //- Dimensions [begin, last] index the rows, the dimensions after last make up a row
+    Size begin = prefix.size(), last = begin + nRowDims - 1;
+    hsize_t rowSize = std::accumulate(dims.begin() + last + 1, dims.end(), hsize_t(1), std::multiplies<hsize_t>());
+
+    //- Rows are visited in file order, HDF5 transfers the elements of both selections in ascending order
+    std::vector<Size> order(fileRows.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&fileRows](Size i, Size j) { return fileRows[i] < fileRows[j]; });
+
+    bool isMonotonic = true;
+
+    for (Size k = 1; k < order.size() && isMonotonic; ++k)
+        isMonotonic = memRows[order[k]] > memRows[order[k - 1]];
+
+    //- Otherwise the rows are packed in file order and the whole buffer is selected
+    std::vector<T> packed;
+
+    if (!isMonotonic)
+    {
+        packed.reserve(rowSize * order.size());
+
+        for (Size i: order)
+            packed.insert(packed.end(), data + rowSize * memRows[i], data + rowSize * (memRows[i] + 1));
+
+        data = packed.data();
+        memSize = packed.size();
+    }
+
+    Handle mspace(check(H5Screate_simple(1, &memSize, nullptr), "write", what), H5Sclose);
+
+    check(H5Sselect_none(mspace), "write", what);
+    check(H5Sselect_none(fspace), "write", what);
+
+    std::vector<hsize_t> fileOffset(dims.size(), 0), fileCount(dims.begin(), dims.end());
+    std::copy(prefix.begin(), prefix.end(), fileOffset.begin());
+    std::fill(fileCount.begin(), fileCount.begin() + last + 1, 1);
+
+    for (Size k = 0; k < order.size();)
+    {
+        //- A block ends at a gap in either ordering or at the end of the last row dimension
+        hsize_t row = fileRows[order[k]];
+        hsize_t lastIdx = row % dims[last];
+        Size n = 1;
+
+        while (k + n < order.size()
+               && fileRows[order[k + n]] == row + n
+               && (!isMonotonic || memRows[order[k + n]] == memRows[order[k]] + n)
+               && lastIdx + n < dims[last])
+            ++n;
+
+        for (Size d = last + 1; d-- > begin;)
+        {
+            fileOffset[d] = row % dims[d];
+            row /= dims[d];
+        }
+
+        fileCount[last] = n;
+
+        hsize_t memOffset = rowSize * (isMonotonic ? memRows[order[k]] : k), memCount = rowSize * n;
+
+        check(H5Sselect_hyperslab(fspace, H5S_SELECT_OR, fileOffset.data(), nullptr, fileCount.data(), nullptr),
+              "write", what);
+        check(H5Sselect_hyperslab(mspace, H5S_SELECT_OR, &memOffset, nullptr, &memCount, nullptr), "write", what);
+
+        k += n;
+    }
+
+    //- Processes without data still take part in the collective write
+    check(H5Dwrite(did, nativeType<T>(), mspace, fspace, dxpl_, data), "write", what);
+}
+
+template<class T>
+std::vector<T> Hdf5File::read(const std::string &path) const
+{
+    std::string what = "unable to read \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "read", what), H5Dclose);
+    Handle space(check(H5Dget_space(did), "read", what), H5Sclose);
+
+    std::vector<T> data(check(H5Sget_simple_extent_npoints(space), "read", what));
+
+    check(H5Dread(did, nativeType<T>(), H5S_ALL, H5S_ALL, dxpl_, data.data()), "read", what);
+
+    return data;
+}
+
+template<class T>
+void Hdf5File::read(const std::string &path,
+                    T *data,
+                    const std::vector<hsize_t> &offset,
+                    const std::vector<hsize_t> &count) const
+{
+    std::string what = "unable to read \"" + path + "\"";
+
+    Handle did(check(H5Dopen(fid_, path.c_str(), H5P_DEFAULT), "read", what), H5Dclose);
+    Handle fspace(check(H5Dget_space(did), "read", what), H5Sclose);
+    Handle mspace(check(H5Screate_simple(count.size(), count.data(), nullptr), "read", what), H5Sclose);
+
+    selectBlock(mspace, fspace, offset, count);
+
+    check(H5Dread(did, nativeType<T>(), mspace, fspace, dxpl_, data), "read", what);
+}
+
+//- Protected
+
+void Hdf5File::selectBlock(hid_t mspace,
+                           hid_t fspace,
+                           const std::vector<hsize_t> &offset,
+                           const std::vector<hsize_t> &count)
+{
+    //- Processes without data still take part in collective transfers
+    if (std::find(count.begin(), count.end(), 0) != count.end())
+    {
+        check(H5Sselect_none(mspace), "selectBlock", "unable to select an empty block");
+        check(H5Sselect_none(fspace), "selectBlock", "unable to select an empty block");
+    }
+    else
+        check(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr),
+              "selectBlock", "unable to select a block");
+}
+
+//- Instantiations
+
+#define PHASE_HDF5_FILE_INSTANTIATE(T) \
+    template void Hdf5File::createDataset<T>(const std::string&, const std::vector<hsize_t>&, \
+                                             const std::vector<hsize_t>&, const std::vector<hsize_t>&, \
+                                             const Filters&); \
+    template void Hdf5File::write<T>(const std::string&, const T*, \
+                                     const std::vector<hsize_t>&, const std::vector<hsize_t>&); \
+    template void Hdf5File::write<T>(const std::string&, const T*, hsize_t, \
+                                     const std::vector<hsize_t>&, const std::vector<hsize_t>&, \
+                                     const std::vector<hsize_t>&, int); \
+    template std::vector<T> Hdf5File::read<T>(const std::string&) const; \
+    template void Hdf5File::read<T>(const std::string&, T*, \
+                                    const std::vector<hsize_t>&, const std::vector<hsize_t>&) const;
+
+PHASE_HDF5_FILE_INSTANTIATE(char)
+PHASE_HDF5_FILE_INSTANTIATE(int)
+PHASE_HDF5_FILE_INSTANTIATE(long)
+PHASE_HDF5_FILE_INSTANTIATE(unsigned long)
+PHASE_HDF5_FILE_INSTANTIATE(float)
+PHASE_HDF5_FILE_INSTANTIATE(double)
@@ -0,0 +1,127 @@
+#ifndef PHASE_HDF5_FILE_H
+#define PHASE_HDF5_FILE_H
+
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+#include "Communicator.h"
+
+class Hdf5File
+{
+public:
+
+    enum Mode
+    {
+        READ, WRITE, MODIFY
+    };
+
+    //- Chunk filters, applied in the order scale-offset, shuffle, deflate or zstd
+    struct Filters
+    {
+        Filters()
+            :
+              shuffle(false),
+              deflateLevel(0),
+              zstdLevel(0),
+              decimalDigits(-1)
+        {}
+
+        bool shuffle;
+
+        //- A level of zero disables the compressor
+        int deflateLevel, zstdLevel;
+
+        //- Decimal digits kept by the lossy scale-offset filter of floating point data, negative to disable
+        int decimalDigits;
+    };
+
+    Hdf5File();
+
+    //- All processes of comm must open the file together, writes are collective
+    Hdf5File(const std::string &filename, Mode mode, const Communicator &comm);
+
+    //- Owns HDF5 handles
+    Hdf5File(const Hdf5File &) = delete;
+
+    Hdf5File &operator=(const Hdf5File &) = delete;
+
+    ~Hdf5File();
+
+    void open(const std::string &filename, Mode mode, const Communicator &comm);
+
+    void close();
+
+    bool isOpen() const
+    { return fid_ >= 0; }
+
+    void flush();
+
+    //- Groups and datasets
+    bool exists(const std::string &path) const;
+
+    void createGroup(const std::string &path);
+
+    //- Creates a chunked dataset, a maxDims entry of H5S_UNLIMITED makes that dimension extendible. T is the
+    //  type stored in the file, writes from other native types are converted
+    template<class T>
+    void createDataset(const std::string &path,
+                       const std::vector<hsize_t> &dims,
+                       const std::vector<hsize_t> &maxDims,
+                       const std::vector<hsize_t> &chunk,
+                       const Filters &filters = Filters());
+
+    std::vector<hsize_t> dims(const std::string &path) const;
+
+    void extend(const std::string &path, const std::vector<hsize_t> &dims);
+
+    //- Collective write of a contiguous buffer into the block [offset, offset + count), which may be empty
+    template<class T>
+    void write(const std::string &path,
+               const T *data,
+               const std::vector<hsize_t> &offset,
+               const std::vector<hsize_t> &count);
+
+    //- Collective scattered write of rows. The leading dimensions are fixed at prefix, the next nRowDims
+    //  dimensions are indexed by flat row ids and a row spans all remaining dimensions. Row memRows[i] of a
+    //  buffer of memSize values goes to row fileRows[i]. Runs of consecutive rows are selected as hyperslab
+    //  blocks, the buffer is only packed if the two orderings differ
+    template<class T>
+    void write(const std::string &path,
+               const T *data,
+               hsize_t memSize,
+               const std::vector<hsize_t> &memRows,
+               const std::vector<hsize_t> &fileRows,
+               const std::vector<hsize_t> &prefix = std::vector<hsize_t>(),
+               int nRowDims = 1);
+
+    //- Reads a whole dataset on every process
+    template<class T>
+    std::vector<T> read(const std::string &path) const;
+
+    //- Collective read of the block [offset, offset + count) into a contiguous buffer
+    template<class T>
+    void read(const std::string &path,
+              T *data,
+              const std::vector<hsize_t> &offset,
+              const std::vector<hsize_t> &count) const;
+
+protected:
+
+    template<class T>
+    static hid_t nativeType();
+
+    static void selectBlock(hid_t mspace,
+                            hid_t fspace,
+                            const std::vector<hsize_t> &offset,
+                            const std::vector<hsize_t> &count);
+
+    //- Throws if an HDF5 call returned an error
+    template<class T>
+    static T check(T status, const std::string &method, const std::string &what);
+
+    hid_t fid_, dxpl_;
+};
+
+#endif
@@ -22,3 +22,9 @@ void PostProcessingInterface::compute(Scalar time, bool force)
     for (auto &obj: objs_)
         obj->compute(time, force);
 }
+
+void PostProcessingInterface::flush()
+{
+    for (auto &obj: objs_)
+        obj->flush();
+}
@@ -22,6 +22,10 @@ public:
 
         virtual bool do_update();
 
+        //- Writes any output the object buffers
+        virtual void flush()
+        {}
+
     protected:
 
         void createOutputDirectory() const;
@@ -33,6 +37,9 @@ public:
 
     virtual void compute(Scalar time, bool force = false);
 
+    //- Completes any output still in progress
+    virtual void flush();
+
 protected:
 
     boost::filesystem::path path_;
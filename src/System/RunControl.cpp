@@ -13,6 +13,9 @@ void RunControl::run(const CommandLine &cl,
     Scalar maxTime = input.caseInput().get<Scalar>("Solver.maxTime");
     Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
 
+    //- Checkpoints are independent from the output, zero disables them
+    int checkpointFrequency = input.caseInput().get<int>("Checkpoint.writeFrequency", 0);
+
     //- Print the solver info
     solver.printf("%s\n", (std::string(96, '-')).c_str());
     solver.printf("%s", solver.info().c_str());
@@ -26,6 +29,12 @@ void RunControl::run(const CommandLine &cl,
     Scalar time = solver.getStartTime();
     Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver.maxTimeStep());
 
+    //- Overwrites the initialized state, including the time and time step
+    if (cl.get<bool>("restart"))
+        solver.readCheckpoint(time, timeStep);
+
+    bool isCheckpointed = true;
+
     //- Initial output
     postProcessing.compute(0., true);
 
@@ -39,6 +48,15 @@ void RunControl::run(const CommandLine &cl,
         solver.solve(timeStep);
         postProcessing.compute(time + timeStep, false);
 
+        isCheckpointed = checkpointFrequency > 0 && (iterNo + 1) % checkpointFrequency == 0;
+
+        //- Checkpoints use HDF5 on this thread, asynchronous output must be idle
+        if (isCheckpointed)
+        {
+            postProcessing.flush();
+            solver.writeCheckpoint(time + timeStep, solver.computeMaxTimeStep(maxCo, timeStep));
+        }
+
         time_.stop();
 
         solver.printf("Time step: %.2e s\n", timeStep);
@@ -50,6 +68,13 @@ void RunControl::run(const CommandLine &cl,
     }
     time_.stop();
 
+    //- Pending output is written before reaching maxTime or maxWallTime is reported
+    postProcessing.flush();
+
+    //- The run can be continued from where it stopped
+    if (checkpointFrequency > 0 && !isCheckpointed)
+        solver.writeCheckpoint(time, timeStep);
+
     solver.printf("%s\n", (std::string(96, '*')).c_str());
     solver.printf("Calculation complete.\n");
     solver.printf("Elapsed time: %s\n", time_.elapsedTime().c_str());
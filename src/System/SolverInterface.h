@@ -28,6 +28,13 @@ public:
 
     virtual Scalar solve(Scalar timeStep) = 0;
 
+    //- Checkpoints hold the complete state needed to continue a run, timeStep is the next step to take
+    virtual void writeCheckpoint(Scalar time, Scalar timeStep)
+    {}
+
+    virtual bool readCheckpoint(Scalar &time, Scalar &timeStep)
+    { return false; }
+
     virtual int printf(const char *format, ...) const = 0;
 
     virtual const Communicator& comm() const = 0;
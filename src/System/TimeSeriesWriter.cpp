@@ -0,0 +1,101 @@
+#include <fstream>
+#include <cstring>
+
+#include "TimeSeriesWriter.h"
+
+TimeSeriesWriter::TimeSeriesWriter(int flushFrequency, Size maxBufferSize)
+    :
+      flushFrequency_(std::max(flushFrequency, 1)),
+      nSyncs_(0),
+      bufferSize_(0),
+      maxBufferSize_(maxBufferSize)
+{
+
+}
+
+TimeSeriesWriter::~TimeSeriesWriter()
+{
+    flush();
+}
+
+void TimeSeriesWriter::create(const std::string &filename, const std::string &text)
+{
+    Buffer &buffer = buffers_[filename];
+
+    bufferSize_ += text.size() - buffer.text.size();
+    buffer.truncate = true;
+    buffer.text = text;
+}
+
+void TimeSeriesWriter::append(const std::string &filename, const std::string &text)
+{
+    auto insert = buffers_.insert(std::make_pair(filename, Buffer{false, std::string()}));
+
+    insert.first->second.text += text;
+    bufferSize_ += text.size();
+}
+
+void TimeSeriesWriter::sync(const Communicator &comm)
+{
+    gather(comm);
+
+    if (++nSyncs_ % flushFrequency_ == 0 || bufferSize_ > maxBufferSize_)
+        flush();
+}
+
+void TimeSeriesWriter::flush()
+{
+    for (const auto &entry: buffers_)
+    {
+        std::ofstream fout(entry.first, entry.second.truncate ? std::ofstream::out : std::ofstream::out | std::ofstream::app);
+        fout << entry.second.text;
+        fout.close();
+    }
+
+    buffers_.clear();
+    bufferSize_ = 0;
+}
+
+//- Protected
+
+void TimeSeriesWriter::gather(const Communicator &comm)
+{
+    if (comm.nProcs() == 1)
+        return;
+
+    //- Entries are packed as filename, truncate flag and text, each name and text terminated by a null
+    std::vector<char> packed;
+
+    if (!comm.isMainProc())
+    {
+        for (const auto &entry: buffers_)
+        {
+            packed.insert(packed.end(), entry.first.begin(), entry.first.end());
+            packed.push_back('\0');
+            packed.push_back(entry.second.truncate ? 1 : 0);
+            packed.insert(packed.end(), entry.second.text.begin(), entry.second.text.end());
+            packed.push_back('\0');
+        }
+
+        buffers_.clear();
+        bufferSize_ = 0;
+    }
+
+    packed = comm.gatherv(comm.mainProcNo(), packed);
+
+    for (Size i = 0; i < packed.size();)
+    {
+        std::string filename(packed.data() + i);
+        i += filename.size() + 1;
+
+        bool truncate = packed[i++];
+
+        std::string text(packed.data() + i);
+        i += text.size() + 1;
+
+        if (truncate)
+            create(filename, text);
+        else
+            append(filename, text);
+    }
+}
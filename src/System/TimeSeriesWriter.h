@@ -0,0 +1,52 @@
+#ifndef PHASE_TIME_SERIES_WRITER_H
+#define PHASE_TIME_SERIES_WRITER_H
+
+#include <map>
+#include <string>
+
+#include "Types/Types.h"
+#include "Communicator.h"
+
+//- Buffers text output for many files in memory. Each process buffers the rows it computes, a sync moves
+//  them to the main process in one collective, and the main process writes each file once per flush
+//  instead of reopening it for every row
+class TimeSeriesWriter
+{
+public:
+
+    TimeSeriesWriter(int flushFrequency = 100, Size maxBufferSize = 8 * 1024 * 1024);
+
+    //- Writes any remaining buffered text
+    ~TimeSeriesWriter();
+
+    //- Starts a file, discarding any previous content
+    void create(const std::string &filename, const std::string &text = "");
+
+    void append(const std::string &filename, const std::string &text);
+
+    //- Collective, gathers the buffered text on the main process, which writes it every flushFrequency
+    //  syncs or when its buffer grows past the maximum size
+    void sync(const Communicator &comm);
+
+    void flush();
+
+protected:
+
+    struct Buffer
+    {
+        bool truncate;
+
+        std::string text;
+    };
+
+    void gather(const Communicator &comm);
+
+    //- Ordered, so files are written in the same order on every flush
+    std::map<std::string, Buffer> buffers_;
+
+    int flushFrequency_, nSyncs_;
+
+    Size bufferSize_, maxBufferSize_;
+};
+
+#endif
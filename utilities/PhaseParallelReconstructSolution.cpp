@@ -0,0 +1,584 @@
+#include <vector>
+#include <unordered_map>
+#include <set>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <cstring>
+#include <cstdio>
+
+#include <regex>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+#include <cgnslib.h>
+
+#include "System/Communicator.h"
+
+//- Nodes shared between procs carry identical coordinates, so they are merged on their exact bit patterns
+struct NodeKey
+{
+    double x, y;
+
+    bool operator==(const NodeKey &other) const
+    { return x == other.x && y == other.y; }
+};
+
+struct NodeKeyHash
+{
+    size_t operator()(const NodeKey &key) const
+    { return std::hash<double>()(key.x) ^ (std::hash<double>()(key.y) * 0x9e3779b97f4a7c15ul); }
+};
+
+//- One time step, either a solution directory or a flow solution inside the compact proc files
+struct TimeStep
+{
+    double time;
+
+    std::string name;
+
+    int sid;
+};
+
+//- Owned cells of a proc, local ids in their output order
+struct ProcCells
+{
+    cgsize_t nLocalCells;
+
+    std::vector<int> ownedIds;
+};
+
+static std::string gridFilename(bool compact, int proc)
+{
+    return compact ? "./solution/proc" + std::to_string(proc) + ".cgns"
+                   : "./solution/Proc" + std::to_string(proc) + "/Grid.cgns";
+}
+
+static std::string solutionFilename(bool compact, int proc, const TimeStep &step)
+{
+    return compact ? gridFilename(compact, proc)
+                   : "./solution/" + step.name + "/Proc" + std::to_string(proc) + "/Solution.cgns";
+}
+
+static int openFile(const std::string &filename, int mode)
+{
+    int fn;
+
+    if (cg_open(filename.c_str(), mode, &fn) != CG_OK)
+        throw std::runtime_error("could not open \"" + filename + "\": " + cg_get_error());
+
+    return fn;
+}
+
+//- Index of the "Info" solution holding ProcNo and GlobalID
+static int infoSolution(int fn)
+{
+    int nsols;
+    cg_nsols(fn, 1, 1, &nsols);
+
+    for (int S = 1; S <= nsols; ++S)
+    {
+        char name[33];
+        CGNS_ENUMT(GridLocation_t) location;
+        cg_sol_info(fn, 1, 1, S, name, &location);
+
+        if (strcmp(name, "Info") == 0)
+            return S;
+    }
+
+    throw std::runtime_error("no \"Info\" solution found.");
+}
+
+//- Node ids from before partitioning, empty for output written without them
+static std::vector<long> readNodeGlobalIds(int fn, cgsize_t nNodes)
+{
+    int nuserdata;
+    cg_goto(fn, 1, "Zone_t", 1, "end");
+    cg_nuser_data(&nuserdata);
+
+    for (int U = 1; U <= nuserdata; ++U)
+    {
+        char name[33];
+        cg_user_data_read(U, name);
+
+        if (strcmp(name, "GlobalIDs") != 0)
+            continue;
+
+        int narrays;
+        cg_gorel(fn, "UserDefinedData_t", U, "end");
+        cg_narrays(&narrays);
+
+        for (int A = 1; A <= narrays; ++A)
+        {
+            CGNS_ENUMT(DataType_t) type;
+            int dataDim;
+            cgsize_t dimVals[12];
+            cg_array_info(A, name, &type, &dataDim, dimVals);
+
+            if (strcmp(name, "Nodes") == 0 && dimVals[0] == nNodes)
+            {
+                std::vector<long> ids(nNodes);
+                cg_array_read_as(A, CGNS_ENUMV(LongInteger), ids.data());
+                return ids;
+            }
+        }
+    }
+
+    return std::vector<long>();
+}
+
+static std::vector<TimeStep> findTimeSteps(bool compact, int stride)
+{
+    using namespace boost::filesystem;
+
+    std::vector<TimeStep> steps;
+
+    if (compact)
+    {
+        //- The first proc holds the same flow solutions as all others
+        int fn = openFile(gridFilename(compact, 0), CG_MODE_READ);
+
+        int nsols;
+        cg_nsols(fn, 1, 1, &nsols);
+
+        std::regex re("FlowSolution([0-9]+)");
+
+        for (int S = 1; S <= nsols; ++S)
+        {
+            char name[33];
+            CGNS_ENUMT(GridLocation_t) location;
+            cg_sol_info(fn, 1, 1, S, name, &location);
+
+            if (!std::regex_match(name, re))
+                continue;
+
+            int ndescriptors;
+            cg_goto(fn, 1, "Zone_t", 1, "FlowSolution_t", S, "end");
+            cg_ndescriptors(&ndescriptors);
+
+            for (int D = 1; D <= ndescriptors; ++D)
+            {
+                char dname[33], *text;
+                cg_descriptor_read(D, dname, &text);
+
+                if (strcmp(dname, "SolutionTime") == 0)
+                    steps.push_back(TimeStep{std::stod(text), text, S});
+
+                cg_free(text);
+            }
+        }
+
+        cg_close(fn);
+    }
+    else
+    {
+        std::regex re("[0-9]+\\.[0-9]+");
+
+        for (directory_iterator end, dir("./solution"); dir != end; ++dir)
+            if (regex_match(dir->path().filename().string(), re))
+                steps.push_back(TimeStep{std::stod(dir->path().filename().string()), dir->path().filename().string(), 1});
+    }
+
+    // must do this since the directory_iterator won't sort
+    std::sort(steps.begin(), steps.end(), [](const TimeStep &lhs, const TimeStep &rhs) { return lhs.time < rhs.time; });
+
+    std::vector<TimeStep> strided;
+
+    for (int i = 0; i < steps.size(); i += stride)
+        strided.push_back(steps[i]);
+
+    return strided;
+}
+
+static ProcCells readOwnership(bool compact, int proc)
+{
+    int fn = openFile(gridFilename(compact, proc), CG_MODE_READ);
+
+    char name[33];
+    cgsize_t sizes[3];
+    cg_zone_read(fn, 1, 1, name, sizes);
+
+    std::vector<int> ownership(sizes[1]);
+    cgsize_t rmin = 1, rmax = sizes[1];
+    cg_field_read(fn, 1, 1, infoSolution(fn), "ProcNo", CGNS_ENUMV(Integer), &rmin, &rmax, ownership.data());
+
+    cg_close(fn);
+
+    ProcCells cells;
+    cells.nLocalCells = sizes[1];
+
+    for (int i = 0; i < ownership.size(); ++i)
+        if (ownership[i] == proc)
+            cells.ownedIds.push_back(i);
+
+    return cells;
+}
+
+static cgsize_t writeGrid(bool compact, const std::vector<ProcCells> &procCells, const std::string &filename)
+{
+    //- Global nodes and elements, in the output order. Nodes are scattered by their global ids, output
+    //  written without them is merged on coordinates
+    std::vector<cgsize_t> globalToOutputId;
+    std::unordered_map<NodeKey, cgsize_t, NodeKeyHash> nodeIds;
+    std::vector<double> xcoords, ycoords;
+    std::vector<cgsize_t> elements;
+    std::vector<int> ownership;
+    std::vector<long> globalIds;
+
+    for (int proc = 0; proc < procCells.size(); ++proc)
+    {
+        std::cout << "Reading grid " << gridFilename(compact, proc) << "...\n";
+
+        int fn = openFile(gridFilename(compact, proc), CG_MODE_READ);
+
+        char name[33];
+        cgsize_t sizes[3];
+        cg_zone_read(fn, 1, 1, name, sizes);
+
+        cgsize_t rmin = 1, rmax = sizes[0];
+        std::vector<double> buffer[] = {std::vector<double>(sizes[0]), std::vector<double>(sizes[0])};
+
+        cg_coord_read(fn, 1, 1, "CoordinateX", CGNS_ENUMV(RealDouble), &rmin, &rmax, buffer[0].data());
+        cg_coord_read(fn, 1, 1, "CoordinateY", CGNS_ENUMV(RealDouble), &rmin, &rmax, buffer[1].data());
+
+        cgsize_t elementDataSize, parentData;
+        cg_ElementDataSize(fn, 1, 1, 1, &elementDataSize);
+
+        std::vector<cgsize_t> elementBuffer(elementDataSize);
+        cg_elements_read(fn, 1, 1, 1, elementBuffer.data(), &parentData);
+
+        //- Element offsets in the mixed connectivity
+        std::vector<cgsize_t> elementStart;
+
+        for (cgsize_t i = 0; i < elementBuffer.size();)
+        {
+            int npe;
+            cg_npe((CGNS_ENUMT(ElementType_t)) elementBuffer[i], &npe);
+
+            if (npe <= 0)
+                throw std::runtime_error("unsupported element type on proc " + std::to_string(proc) + ".");
+
+            elementStart.push_back(i);
+            i += npe + 1;
+        }
+
+        std::vector<long> nodeGlobalIds = readNodeGlobalIds(fn, sizes[0]);
+
+        rmin = 1;
+        rmax = sizes[1];
+        std::vector<long> procGlobalIds(sizes[1]);
+        cg_field_read(fn, 1, 1, infoSolution(fn), "GlobalID", CGNS_ENUMV(LongInteger), &rmin, &rmax, procGlobalIds.data());
+
+        cg_close(fn);
+
+        //- Only nodes referenced by owned cells are kept
+        for (int id: procCells[proc].ownedIds)
+        {
+            cgsize_t i = elementStart[id];
+            int npe;
+            cg_npe((CGNS_ENUMT(ElementType_t)) elementBuffer[i], &npe);
+
+            elements.push_back(elementBuffer[i]);
+
+            for (int j = 1; j <= npe; ++j)
+            {
+                cgsize_t node = elementBuffer[i + j] - 1, id;
+
+                if (!nodeGlobalIds.empty())
+                {
+                    long gid = nodeGlobalIds[node];
+
+                    if (gid >= globalToOutputId.size())
+                        globalToOutputId.resize(gid + 1, 0);
+
+                    if (globalToOutputId[gid] == 0)
+                        globalToOutputId[gid] = xcoords.size() + 1;
+
+                    id = globalToOutputId[gid];
+                }
+                else
+                    id = nodeIds.insert(std::make_pair(NodeKey{buffer[0][node], buffer[1][node]}, xcoords.size() + 1)).first->second;
+
+                if (id == xcoords.size() + 1)
+                {
+                    xcoords.push_back(buffer[0][node]);
+                    ycoords.push_back(buffer[1][node]);
+                }
+
+                elements.push_back(id);
+            }
+
+            ownership.push_back(proc);
+            globalIds.push_back(procGlobalIds[id]);
+        }
+    }
+
+    std::cout << "Number of unique nodes: " << xcoords.size() << std::endl
+              << "Number of elements: " << ownership.size() << std::endl;
+
+    //- Write the grid
+    std::string tmpFilename = filename + ".tmp";
+
+    int fn = openFile(tmpFilename, CG_MODE_WRITE), bid, zid, xid, sid, fid;
+    cg_base_write(fn, "Grid", 2, 2, &bid);
+
+    cgsize_t sizes[] = {(cgsize_t) xcoords.size(), (cgsize_t) ownership.size(), 0};
+    cg_zone_write(fn, bid, "Zone", sizes, CGNS_ENUMV(Unstructured), &zid);
+
+    cg_coord_write(fn, bid, zid, CGNS_ENUMV(RealDouble), "CoordinateX", xcoords.data(), &xid);
+    cg_coord_write(fn, bid, zid, CGNS_ENUMV(RealDouble), "CoordinateY", ycoords.data(), &xid);
+    cg_section_write(fn, bid, zid, "Cells", CGNS_ENUMV(MIXED), 1, sizes[1], 0, elements.data(), &sid);
+
+    cg_sol_write(fn, bid, zid, "Info", CGNS_ENUMV(CellCenter), &sid);
+    cg_field_write(fn, bid, zid, sid, CGNS_ENUMV(Integer), "ProcNo", ownership.data(), &fid);
+    cg_field_write(fn, bid, zid, sid, CGNS_ENUMV(LongInteger), "GlobalID", globalIds.data(), &fid);
+
+    cg_close(fn);
+
+    boost::filesystem::rename(tmpFilename, filename);
+
+    return sizes[0];
+}
+
+//- Gathers the owned cells of one field of one proc and writes them over the proc's block of the output
+template<class T>
+static void reconstructField(int in, int sid, int out, int outSid, const char *name, CGNS_ENUMT(DataType_t) type,
+                             const ProcCells &cells, cgsize_t offset, std::vector<T> &buffer, std::vector<T> &owned)
+{
+    cgsize_t rmin = 1, rmax = cells.nLocalCells;
+    buffer.resize(cells.nLocalCells);
+    cg_field_read(in, 1, 1, sid, name, type, &rmin, &rmax, buffer.data());
+
+    owned.resize(cells.ownedIds.size());
+
+    for (int i = 0; i < cells.ownedIds.size(); ++i)
+        owned[i] = buffer[cells.ownedIds[i]];
+
+    int fid;
+    rmin = offset + 1;
+    rmax = offset + cells.ownedIds.size();
+    cg_field_partial_write(out, 1, 1, outSid, type, name, &rmin, &rmax, owned.data(), &fid);
+}
+
+static void reconstructTimeStep(bool compact, const TimeStep &step, const std::vector<ProcCells> &procCells,
+                                const std::vector<cgsize_t> &offsets, cgsize_t nNodes, const std::string &filename)
+{
+    std::string tmpFilename = filename + ".tmp";
+
+    int out = openFile(tmpFilename, CG_MODE_WRITE), bid, zid, sid;
+    cg_base_write(out, "Solution", 2, 2, &bid);
+
+    cgsize_t sizes[] = {nNodes, offsets.back(), 0};
+    cg_zone_write(out, bid, "Zone", sizes, CGNS_ENUMV(Unstructured), &zid);
+
+    //- The grid is shared by all time steps
+    cg_goto(out, bid, "Zone_t", zid, "end");
+    cg_link_write("GridCoordinates", "Grid.cgns", "/Grid/Zone/GridCoordinates");
+    cg_link_write("Cells", "Grid.cgns", "/Grid/Zone/Cells");
+
+    cg_sol_write(out, bid, zid, "Solution", CGNS_ENUMV(CellCenter), &sid);
+
+    //- Only one proc and one field are held in memory at a time
+    std::vector<int> intBuffer, intOwned;
+    std::vector<long> longBuffer, longOwned;
+    std::vector<double> doubleBuffer, doubleOwned;
+
+    for (int proc = 0; proc < procCells.size(); ++proc)
+    {
+        const ProcCells &cells = procCells[proc];
+
+        if (cells.ownedIds.empty())
+            continue;
+
+        int in = openFile(solutionFilename(compact, proc, step), CG_MODE_READ);
+
+        int nfields;
+        cg_nfields(in, 1, 1, step.sid, &nfields);
+
+        for (int field = 1; field <= nfields; ++field)
+        {
+            char name[33];
+            CGNS_ENUMT(DataType_t) type;
+            cg_field_info(in, 1, 1, step.sid, field, &type, name);
+
+            //- Ownership and global ids are part of the grid
+            if (strcmp(name, "ProcNo") == 0 || strcmp(name, "GlobalID") == 0)
+                continue;
+
+            switch (type)
+            {
+            case CGNS_ENUMV(Integer):
+                reconstructField(in, step.sid, out, sid, name, type, cells, offsets[proc], intBuffer, intOwned);
+                break;
+            case CGNS_ENUMV(LongInteger):
+                reconstructField(in, step.sid, out, sid, name, type, cells, offsets[proc], longBuffer, longOwned);
+                break;
+            case CGNS_ENUMV(RealDouble):
+                reconstructField(in, step.sid, out, sid, name, type, cells, offsets[proc], doubleBuffer, doubleOwned);
+                break;
+            default:
+                std::cout << "\t*** WARNING *** Skipping field \"" << name << "\" of unsupported type.\n";
+            }
+        }
+
+        cg_close(in);
+    }
+
+    //- Write zone iterative data
+    char flowSolutionPtr[33];
+    snprintf(flowSolutionPtr, sizeof(flowSolutionPtr), "%-32s", "Solution");
+
+    cg_ziter_write(out, bid, zid, "ZoneIterativeData");
+    cg_goto(out, bid, "Zone_t", zid, "ZoneIterativeData_t", 1, "end");
+    sizes[0] = 32;
+    sizes[1] = 1;
+    cg_array_write("FlowSolutionPointers", CGNS_ENUMV(Character), 2, sizes, flowSolutionPtr);
+
+    //- Write base iterative data
+    cg_biter_write(out, bid, "TimeIterValues", 1);
+    cg_goto(out, bid, "BaseIterativeData_t", 1, "end");
+    cg_array_write("TimeValues", CGNS_ENUMV(RealDouble), 1, &sizes[1], &step.time);
+    cg_simulation_type_write(out, bid, CGNS_ENUMV(TimeAccurate));
+
+    cg_close(out);
+
+    boost::filesystem::rename(tmpFilename, filename);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace std;
+    using namespace boost::filesystem;
+
+    Communicator::init(argc, argv);
+
+    {
+        Communicator comm;
+
+        int stride = 1;
+        bool compact = false, force = false;
+
+        for (int argno = 1; argno < argc; ++argno)
+            if (strcmp(argv[argno], "-s") == 0 || strcmp(argv[argno], "--stride") == 0)
+            {
+                try
+                {
+                    stride = std::max(std::stoi(argv[++argno]), 1);
+                }
+                catch (...)
+                {
+                    throw std::invalid_argument("bad argument for stride.");
+                }
+            }
+            else if (strcmp(argv[argno], "-c") == 0 || strcmp(argv[argno], "--compact") == 0)
+                compact = true;
+            else if (strcmp(argv[argno], "-f") == 0 || strcmp(argv[argno], "--force") == 0)
+                force = true;
+            else if (strcmp(argv[argno], "-h") == 0)
+            {
+                comm.printf("phase-parallel-reconstruct-solution\n\n"
+                            "Usage: mpirun -np N phase-parallel-reconstruct-solution [OPTION]...\n\n"
+                            "\t-s|--stride\tSpecify the spacing of time steps to reconstruct\n"
+                            "\t-c|--compact\tRead the compact output (solution/procN.cgns)\n"
+                            "\t-f|--force\tReconstruct the grid and all time steps, even if already present\n\n"
+                            "The grid is written to reconstructed/Grid.cgns and each time step to its own file,\n"
+                            "time steps that were already reconstructed are skipped.\n");
+
+                Communicator::finalize();
+                return 0;
+            }
+
+        //- Count the procs of the run that produced the output
+        int nProcs = 0;
+
+        while (exists(gridFilename(compact, nProcs)))
+            ++nProcs;
+
+        if (nProcs == 0)
+            throw std::runtime_error("no solution output found in \"./solution\".");
+
+        //- Ownership is read by all ranks, one proc at a time
+        vector<int> nLocalCells, ownedIds;
+
+        for (int proc = comm.rank(); proc < nProcs; proc += comm.nProcs())
+        {
+            ProcCells cells = readOwnership(compact, proc);
+            nLocalCells.push_back(cells.nLocalCells);
+            nLocalCells.push_back(cells.ownedIds.size());
+            ownedIds.insert(ownedIds.end(), cells.ownedIds.begin(), cells.ownedIds.end());
+        }
+
+        nLocalCells = comm.allGatherv(nLocalCells);
+        ownedIds = comm.allGatherv(ownedIds);
+
+        //- Gathered data is ordered by rank, each rank holding the procs rank, rank + nRanks, ...
+        vector<ProcCells> procCells(nProcs);
+
+        for (int rank = 0, i = 0, j = 0; rank < comm.nProcs(); ++rank)
+            for (int proc = rank; proc < nProcs; proc += comm.nProcs(), i += 2)
+            {
+                procCells[proc].nLocalCells = nLocalCells[i];
+                procCells[proc].ownedIds.assign(ownedIds.begin() + j, ownedIds.begin() + j + nLocalCells[i + 1]);
+                j += nLocalCells[i + 1];
+            }
+
+        //- Owned cells are numbered proc by proc
+        vector<cgsize_t> offsets(1, 0);
+
+        for (const ProcCells &cells: procCells)
+            offsets.push_back(offsets.back() + cells.ownedIds.size());
+
+        comm.printf("Found output of %d procs, number of global cells = %ld.\n", nProcs, (long) offsets.back());
+
+        //- Grid
+        path gridPath = "./reconstructed/Grid.cgns";
+        cgsize_t nNodes = 0;
+
+        if (comm.isMainProc())
+        {
+            create_directories("./reconstructed");
+
+            if (force || !exists(gridPath))
+                nNodes = writeGrid(compact, procCells, gridPath.string());
+            else
+            {
+                int fn = openFile(gridPath.string(), CG_MODE_READ);
+
+                char name[33];
+                cgsize_t sizes[3];
+                cg_zone_read(fn, 1, 1, name, sizes);
+                cg_close(fn);
+
+                if (sizes[1] != offsets.back())
+                    throw std::runtime_error("existing grid does not match the solution output, use --force.");
+
+                nNodes = sizes[0];
+            }
+        }
+
+        nNodes = comm.broadcast(comm.mainProcNo(), nNodes);
+
+        //- Time steps not yet reconstructed are dealt out to the ranks
+        vector<TimeStep> steps;
+
+        for (const TimeStep &step: findTimeSteps(compact, stride))
+            if (force || !exists("./reconstructed/" + step.name + ".cgns"))
+                steps.push_back(step);
+
+        comm.printf("Reconstructing %d time steps on %d ranks...\n", (int) steps.size(), comm.nProcs());
+
+        for (int i = comm.rank(); i < steps.size(); i += comm.nProcs())
+        {
+            cout << "Rank " << comm.rank() << ": reconstructing time " << steps[i].name << "...\n";
+            reconstructTimeStep(compact, steps[i], procCells, offsets, nNodes, "./reconstructed/" + steps[i].name + ".cgns");
+        }
+
+        comm.barrier();
+        comm.printf("Reconstruction complete.\n");
+    }
+
+    Communicator::finalize();
+
+    return 0;
+}